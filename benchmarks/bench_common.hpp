@@ -1,6 +1,47 @@
 #pragma once
+#include "raccoon/internals/signature.hpp"
 #include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
 #include <vector>
 
 const auto compute_min = [](const std::vector<double>& v) -> double { return *std::min_element(v.begin(), v.end()); };
 const auto compute_max = [](const std::vector<double>& v) -> double { return *std::max_element(v.begin(), v.end()); };
+
+// Given a collection of samples, returns the value at given percentile ( 0 <= p <= 100 ), using nearest-rank method. Reorders the collection in-place.
+inline double
+compute_percentile(std::vector<double>& v, const double p)
+{
+  if (v.empty()) {
+    return 0.;
+  }
+
+  const auto rank = static_cast<size_t>(p / 100. * static_cast<double>(v.size() - 1) + .5);
+  std::nth_element(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(rank), v.end());
+  return v[rank];
+}
+
+// Reports average number of signing attempts per signature and what fraction of attempts got rejected, for each rejection reason.
+inline void
+report_rejection_counters(benchmark::State& state)
+{
+  const auto attempts = static_cast<double>(raccoon_sig::rejection_counters.attempts.load());
+  const auto signatures = static_cast<double>(state.iterations());
+  if (attempts == 0) {
+    return;
+  }
+
+  state.counters["attempts_per_sig"] = attempts / signatures;
+  state.counters["rej_too_long"] = static_cast<double>(raccoon_sig::rejection_counters.too_long.load()) / attempts;
+  state.counters["rej_out_of_bounds"] = static_cast<double>(raccoon_sig::rejection_counters.out_of_bounds.load()) / attempts;
+}
+
+// Kinds of (message, signature) pairs, making up the corpus, fed to staged verification.
+enum class corpus_kind_t : int64_t
+{
+  truncated,     // Signature, missing its last byte
+  unary_run,     // Signature, with an over-long unary run, at some random position
+  out_of_bounds, // Decodable signature, whose hint vector exceeds infinity norm bound
+  forgery,       // Well-formed signature, with tampered challenge hash
+  valid,         // Valid signature
+};
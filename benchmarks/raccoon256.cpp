@@ -1,6 +1,11 @@
 #include "raccoon/raccoon256.hpp"
 #include "bench_common.hpp"
+#include <atomic>
 #include <benchmark/benchmark.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
 
 template<size_t d>
 static void
@@ -40,6 +45,8 @@ bench_raccoon256_sign(benchmark::State& state)
   prng.read(msg);
 
   auto skey = raccoon256::raccoon256_skey_t<d>::generate(seed);
+  raccoon_sig::rejection_counters.reset();
+  raccoon_sig::rejection_counters.enable(true);
 
   for (auto _ : state) {
     skey.sign(msg, sig_bytes);
@@ -50,7 +57,121 @@ bench_raccoon256_sign(benchmark::State& state)
     benchmark::ClobberMemory();
   }
 
+  raccoon_sig::rejection_counters.enable(false);
   state.SetItemsProcessed(state.iterations());
+  report_rejection_counters(state);
+}
+
+template<size_t d>
+static void
+bench_raccoon256_sign_in_place(benchmark::State& state)
+{
+  constexpr size_t fixed_msg_byte_len = 32;
+
+  std::array<uint8_t, raccoon256::SEED_BYTE_LEN> seed{};
+  std::array<uint8_t, raccoon256::SIG_BYTE_LEN> sig_bytes{};
+  std::vector<uint8_t> msg(fixed_msg_byte_len, 0);
+
+  prng::prng_t prng{};
+  prng.read(seed);
+  prng.read(msg);
+
+  auto skey = raccoon256::raccoon256_skey_t<d>::generate(seed);
+
+  for (auto _ : state) {
+    skey.sign_in_place(msg, sig_bytes);
+
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(sig_bytes);
+    benchmark::DoNotOptimize(skey);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmarks speculative signing, with `state.range(0)` -many parallel signing attempts, reporting median and tail latency of a signing call, which is
+// dominated by number of rejected attempts, when signing sequentially.
+template<size_t d>
+static void
+bench_raccoon256_speculative_sign(benchmark::State& state)
+{
+  constexpr size_t fixed_msg_byte_len = 32;
+  const auto num_attempts = static_cast<size_t>(state.range(0));
+
+  std::array<uint8_t, raccoon256::SEED_BYTE_LEN> seed{};
+  std::array<uint8_t, raccoon256::SIG_BYTE_LEN> sig_bytes{};
+  std::vector<uint8_t> msg(fixed_msg_byte_len, 0);
+
+  prng::prng_t prng{};
+  prng.read(seed);
+  prng.read(msg);
+
+  auto skey = raccoon256::raccoon256_skey_t<d>::generate(seed);
+
+  raccoon_thread_pool::thread_pool_t pool(std::max<size_t>(num_attempts - 1, 1));
+  const raccoon_sign_policy::speculative_t policy{ pool, num_attempts };
+
+  std::vector<double> latencies{};
+  for (auto _ : state) {
+    const auto start = std::chrono::steady_clock::now();
+    skey.sign(msg, sig_bytes, policy);
+    const auto end = std::chrono::steady_clock::now();
+
+    latencies.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(sig_bytes);
+    benchmark::DoNotOptimize(skey);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.counters["p50_us"] = compute_percentile(latencies, 50);
+  state.counters["p99_us"] = compute_percentile(latencies, 99);
+}
+
+// Benchmarks batch signing of `state.range(0)` -many messages, spreading them across `state.range(1)` -many pool workers, besides the calling thread,
+// reporting throughput in signatures per second.
+template<size_t d>
+static void
+bench_raccoon256_sign_batch(benchmark::State& state)
+{
+  constexpr size_t fixed_msg_byte_len = 32;
+  const auto batch_size = static_cast<size_t>(state.range(0));
+  const auto num_threads = static_cast<size_t>(state.range(1));
+
+  std::array<uint8_t, raccoon256::SEED_BYTE_LEN> seed{};
+  std::vector<uint8_t> sigs_bytes(batch_size * raccoon256::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msgs(batch_size * fixed_msg_byte_len, 0);
+
+  prng::prng_t prng{};
+  prng.read(seed);
+  prng.read(msgs);
+
+  std::vector<std::span<const uint8_t>> msg_spans{};
+  for (size_t i = 0; i < batch_size; i++) {
+    msg_spans.emplace_back(std::span(msgs).subspan(i * fixed_msg_byte_len, fixed_msg_byte_len));
+  }
+
+  auto skey = raccoon256::raccoon256_skey_t<d>::generate(seed);
+  auto prepared_skey = skey.prepare();
+
+  std::unique_ptr<raccoon_thread_pool::thread_pool_t> pool{};
+  if (num_threads > 0) {
+    pool = std::make_unique<raccoon_thread_pool::thread_pool_t>(num_threads);
+  }
+
+  for (auto _ : state) {
+    prepared_skey.sign_batch(msg_spans, sigs_bytes, pool.get());
+
+    benchmark::DoNotOptimize(msgs);
+    benchmark::DoNotOptimize(sigs_bytes);
+    benchmark::DoNotOptimize(prepared_skey);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch_size));
 }
 
 static void
@@ -85,6 +206,492 @@ bench_raccoon256_verify(benchmark::State& state)
   state.SetItemsProcessed(state.iterations());
 }
 
+static void
+bench_raccoon256_prepared_verify(benchmark::State& state)
+{
+  constexpr size_t fixed_msg_byte_len = 32;
+  constexpr size_t num_shares = 1;
+
+  std::array<uint8_t, raccoon256::SEED_BYTE_LEN> seed{};
+  std::array<uint8_t, raccoon256::SIG_BYTE_LEN> sig_bytes{};
+  std::vector<uint8_t> msg(fixed_msg_byte_len, 0);
+
+  prng::prng_t prng{};
+  prng.read(seed);
+  prng.read(msg);
+
+  auto skey = raccoon256::raccoon256_skey_t<num_shares>::generate(seed);
+  auto pkey = raccoon256::raccoon256_prepared_pkey_t(skey.get_pkey());
+  skey.sign(msg, sig_bytes);
+
+  bool is_verified = true;
+  for (auto _ : state) {
+    is_verified &= pkey.verify(msg, sig_bytes);
+
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(sig_bytes);
+    benchmark::DoNotOptimize(pkey);
+    benchmark::DoNotOptimize(is_verified);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmarks verification of a signature, using a public key bound to the shared public matrix, which is never expanded again.
+static void
+bench_raccoon256_shared_verify(benchmark::State& state)
+{
+  constexpr size_t fixed_msg_byte_len = 32;
+  constexpr size_t num_shares = 1;
+
+  std::array<uint8_t, raccoon256::SEED_BYTE_LEN> seed{};
+  std::array<uint8_t, raccoon256::SIG_BYTE_LEN> sig_bytes{};
+  std::vector<uint8_t> msg(fixed_msg_byte_len, 0);
+
+  prng::prng_t prng{};
+  prng.read(seed);
+  prng.read(msg);
+
+  auto skey = raccoon256::raccoon256_shared_skey_t<num_shares>::generate(raccoon256::raccoon256_shared_matrix_t::get(seed));
+  auto pkey = skey.get_pkey();
+  skey.sign(msg, sig_bytes);
+
+  bool is_verified = true;
+  for (auto _ : state) {
+    is_verified &= pkey.verify(msg, sig_bytes);
+
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(sig_bytes);
+    benchmark::DoNotOptimize(pkey);
+    benchmark::DoNotOptimize(is_verified);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmarks streaming verification of a signature, which generates public matrix A one row at a time.
+static void
+bench_raccoon256_verify_streaming(benchmark::State& state)
+{
+  constexpr size_t fixed_msg_byte_len = 32;
+  constexpr size_t num_shares = 1;
+
+  std::array<uint8_t, raccoon256::SEED_BYTE_LEN> seed{};
+  std::array<uint8_t, raccoon256::SIG_BYTE_LEN> sig_bytes{};
+  std::vector<uint8_t> msg(fixed_msg_byte_len, 0);
+
+  prng::prng_t prng{};
+  prng.read(seed);
+  prng.read(msg);
+
+  auto skey = raccoon256::raccoon256_skey_t<num_shares>::generate(seed);
+  auto pkey = skey.get_pkey();
+  skey.sign(msg, sig_bytes);
+
+  bool is_verified = true;
+  for (auto _ : state) {
+    is_verified &= pkey.verify_streaming(msg, sig_bytes);
+
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(sig_bytes);
+    benchmark::DoNotOptimize(pkey);
+    benchmark::DoNotOptimize(is_verified);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmarks variable-time verification of a signature, using a prepared public key.
+static void
+bench_raccoon256_prepared_verify_vartime(benchmark::State& state)
+{
+  constexpr size_t fixed_msg_byte_len = 32;
+  constexpr size_t num_shares = 1;
+
+  std::array<uint8_t, raccoon256::SEED_BYTE_LEN> seed{};
+  std::array<uint8_t, raccoon256::SIG_BYTE_LEN> sig_bytes{};
+  std::vector<uint8_t> msg(fixed_msg_byte_len, 0);
+
+  prng::prng_t prng{};
+  prng.read(seed);
+  prng.read(msg);
+
+  auto skey = raccoon256::raccoon256_skey_t<num_shares>::generate(seed);
+  auto pkey = raccoon256::raccoon256_prepared_pkey_t(skey.get_pkey());
+  skey.sign(msg, sig_bytes);
+
+  bool is_verified = true;
+  for (auto _ : state) {
+    is_verified &= pkey.verify_vartime(msg, sig_bytes);
+
+    benchmark::DoNotOptimize(msg);
+    benchmark::DoNotOptimize(sig_bytes);
+    benchmark::DoNotOptimize(pkey);
+    benchmark::DoNotOptimize(is_verified);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmarks batch verification of signatures, produced under one key, using a prepared public key, reporting throughput in verifications per second.
+static void
+bench_raccoon256_verify_batch(benchmark::State& state)
+{
+  constexpr size_t fixed_msg_byte_len = 32;
+  constexpr size_t num_shares = 1;
+  const auto batch_size = static_cast<size_t>(state.range(0));
+
+  std::array<uint8_t, raccoon256::SEED_BYTE_LEN> seed{};
+  std::vector<uint8_t> sigs_bytes(batch_size * raccoon256::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msgs(batch_size * fixed_msg_byte_len, 0);
+  auto results = std::make_unique<bool[]>(batch_size);
+
+  prng::prng_t prng{};
+  prng.read(seed);
+  prng.read(msgs);
+
+  std::vector<std::span<const uint8_t>> msg_spans{};
+  for (size_t i = 0; i < batch_size; i++) {
+    msg_spans.emplace_back(std::span(msgs).subspan(i * fixed_msg_byte_len, fixed_msg_byte_len));
+  }
+
+  auto skey = raccoon256::raccoon256_skey_t<num_shares>::generate(seed);
+  auto pkey = raccoon256::raccoon256_prepared_pkey_t(skey.get_pkey());
+  skey.sign_batch(msg_spans, sigs_bytes);
+
+  bool is_verified = true;
+  for (auto _ : state) {
+    is_verified &= pkey.verify_batch(msg_spans, sigs_bytes, std::span(results.get(), batch_size));
+
+    benchmark::DoNotOptimize(msgs);
+    benchmark::DoNotOptimize(sigs_bytes);
+    benchmark::DoNotOptimize(pkey);
+    benchmark::DoNotOptimize(is_verified);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch_size));
+}
+
+// Benchmarks verification of jobs under a few public keys, spread over a work-stealing pool of worker threads, reporting throughput in verifications per
+// second.
+static void
+bench_raccoon256_verify_pool(benchmark::State& state)
+{
+  constexpr size_t fixed_msg_byte_len = 32;
+  constexpr size_t num_shares = 1;
+  constexpr size_t num_keys = 4;
+  constexpr size_t num_jobs = 64;
+  const auto num_threads = static_cast<size_t>(state.range(0));
+
+  std::array<uint8_t, raccoon256::SEED_BYTE_LEN> seed{};
+  std::vector<raccoon256::raccoon256_pkey_t> pkeys{};
+  std::vector<std::vector<uint8_t>> msgs(num_jobs, std::vector<uint8_t>(fixed_msg_byte_len, 0));
+  std::vector<std::vector<uint8_t>> sigs(num_jobs, std::vector<uint8_t>(raccoon256::SIG_BYTE_LEN, 0));
+
+  prng::prng_t prng{};
+
+  for (size_t i = 0; i < num_keys; i++) {
+    prng.read(seed);
+
+    auto skey = raccoon256::raccoon256_skey_t<num_shares>::generate(seed);
+    pkeys.push_back(skey.get_pkey());
+
+    for (size_t j = i; j < num_jobs; j += num_keys) {
+      prng.read(msgs[j]);
+      skey.sign(msgs[j], std::span<uint8_t, raccoon256::SIG_BYTE_LEN>(sigs[j]));
+    }
+  }
+
+  raccoon256::raccoon256_verify_pool_t pool(num_threads);
+  std::vector<std::future<bool>> futures{};
+  futures.reserve(num_jobs);
+
+  bool is_verified = true;
+  for (auto _ : state) {
+    for (size_t j = 0; j < num_jobs; j++) {
+      futures.push_back(pool.submit(pkeys[j % num_keys], msgs[j], sigs[j]));
+    }
+    for (auto& future : futures) {
+      is_verified &= future.get();
+    }
+    futures.clear();
+
+    benchmark::DoNotOptimize(is_verified);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_jobs));
+}
+
+// Benchmarks replayed verifications, answered from a pre-warmed verification cache, shared by `threads` -many threads, spread over `shards` -many
+// shards, reporting fraction of lock acquisitions, which found the shard lock already taken.
+static void
+bench_raccoon256_verify_cache(benchmark::State& state)
+{
+  constexpr size_t fixed_msg_byte_len = 32;
+  constexpr size_t num_shares = 1;
+  constexpr size_t num_triples = 64;
+  constexpr size_t verifications_per_thread = 256;
+  const auto num_threads = static_cast<size_t>(state.range(0));
+  const auto num_shards = static_cast<size_t>(state.range(1));
+
+  std::array<uint8_t, raccoon256::SEED_BYTE_LEN> seed{};
+  std::vector<std::vector<uint8_t>> msgs(num_triples, std::vector<uint8_t>(fixed_msg_byte_len, 0));
+  std::vector<std::vector<uint8_t>> sigs(num_triples, std::vector<uint8_t>(raccoon256::SIG_BYTE_LEN, 0));
+
+  prng::prng_t prng{};
+  prng.read(seed);
+
+  auto skey = raccoon256::raccoon256_skey_t<num_shares>::generate(seed);
+  auto pkey = raccoon256::raccoon256_prepared_pkey_t(skey.get_pkey());
+
+  // Large enough that, however keys are spread over shards, each of them stays resident
+  raccoon256::raccoon256_verify_cache_t cache(4 * num_triples, num_shards);
+
+  for (size_t i = 0; i < num_triples; i++) {
+    prng.read(msgs[i]);
+    skey.sign(msgs[i], std::span<uint8_t, raccoon256::SIG_BYTE_LEN>(sigs[i]));
+    cache.verify(pkey, msgs[i], std::span<const uint8_t, raccoon256::SIG_BYTE_LEN>(sigs[i]));
+  }
+  cache.reset_stats();
+
+  std::atomic<bool> is_verified{ true };
+  for (auto _ : state) {
+    std::vector<std::jthread> threads{};
+
+    for (size_t t = 0; t < num_threads; t++) {
+      threads.emplace_back([&, t] {
+        bool is_verified_local = true;
+
+        for (size_t i = 0; i < verifications_per_thread; i++) {
+          const size_t idx = (t * 7 + i) % num_triples;
+          is_verified_local &= cache.verify(pkey, msgs[idx], std::span<const uint8_t, raccoon256::SIG_BYTE_LEN>(sigs[idx]));
+        }
+
+        if (!is_verified_local) {
+          is_verified = false;
+        }
+      });
+    }
+    threads.clear();
+
+    benchmark::DoNotOptimize(is_verified);
+    benchmark::ClobberMemory();
+  }
+
+  const auto stats = cache.stats();
+  const auto lookups = static_cast<double>(stats.hits + stats.misses);
+
+  state.counters["hit_ratio"] = static_cast<double>(stats.hits) / lookups;
+  state.counters["contended"] = static_cast<double>(stats.contended) / (lookups + static_cast<double>(stats.misses));
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_threads * verifications_per_thread));
+}
+
+// Benchmarks verification against a registry of public keys, keeping at most `prepared` -many of them prepared, s.t. 7 out of every 8 requests target
+// a small hot set of public keys, while the rest are spread over all of them. Reports fraction of requests, which found their public key prepared, along
+// with bytes spent per registered public key, against that of a decoded public key.
+static void
+bench_raccoon256_pkey_registry(benchmark::State& state)
+{
+  constexpr size_t fixed_msg_byte_len = 32;
+  constexpr size_t num_shares = 1;
+  constexpr size_t num_keys = 64;
+  constexpr size_t num_hot_keys = 8;
+  const auto max_prepared = static_cast<size_t>(state.range(0));
+
+  std::array<uint8_t, raccoon256::SEED_BYTE_LEN> seed{};
+  std::array<uint8_t, raccoon256::PKEY_BYTE_LEN> pkey_bytes{};
+  std::vector<std::vector<uint8_t>> sigs(num_keys, std::vector<uint8_t>(raccoon256::SIG_BYTE_LEN, 0));
+  std::vector<uint8_t> msg(fixed_msg_byte_len, 0);
+
+  prng::prng_t prng{};
+  prng.read(msg);
+
+  raccoon256::raccoon256_pkey_registry_t<uint64_t> registry(max_prepared);
+
+  for (size_t i = 0; i < num_keys; i++) {
+    prng.read(seed);
+
+    auto skey = raccoon256::raccoon256_skey_t<num_shares>::generate(seed);
+    skey.get_pkey().as_bytes(pkey_bytes);
+    skey.sign(msg, std::span<uint8_t, raccoon256::SIG_BYTE_LEN>(sigs[i]));
+
+    registry.insert(i, pkey_bytes);
+  }
+
+  // Sequence of public keys, targeted by requests
+  std::vector<size_t> key_seq(1024, 0);
+  for (size_t i = 0; i < key_seq.size(); i++) {
+    std::array<uint8_t, sizeof(uint32_t)> rand_bytes{};
+    prng.read(rand_bytes);
+
+    const auto rand = raccoon_utils::from_le_bytes<uint32_t>(rand_bytes);
+    key_seq[i] = ((i % 8) == 7) ? (rand % num_keys) : (rand % num_hot_keys);
+  }
+
+  size_t req_idx = 0;
+  bool is_verified = true;
+
+  for (auto _ : state) {
+    const size_t key_idx = key_seq[req_idx];
+    is_verified &= registry.verify(key_idx, msg, std::span<const uint8_t, raccoon256::SIG_BYTE_LEN>(sigs[key_idx]));
+    req_idx = (req_idx + 1) % key_seq.size();
+
+    benchmark::DoNotOptimize(is_verified);
+    benchmark::ClobberMemory();
+  }
+
+  const auto stats = registry.stats();
+  state.counters["hit_ratio"] = static_cast<double>(stats.hits) / static_cast<double>(stats.hits + stats.misses);
+  state.counters["packed_bytes"] = static_cast<double>(raccoon256::PKEY_BYTE_LEN);
+  state.counters["decoded_bytes"] = static_cast<double>(sizeof(raccoon_pkey::pkey_t<raccoon256::𝜅, raccoon256::k, raccoon256::𝜈t>));
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmarks preparing a public key, as a verifier process does for each public key it sees for the first time, then verifying one signature. Public
+// matrix A is either expanded into process-local memory ( shared = 0 ) or found already expanded in a shared memory matrix cache ( shared = 1 ).
+static void
+bench_raccoon256_shm_pkey_prepare(benchmark::State& state)
+{
+  constexpr size_t fixed_msg_byte_len = 32;
+  constexpr size_t num_shares = 1;
+  const bool is_shared = state.range(0) != 0;
+
+  std::array<uint8_t, raccoon256::SEED_BYTE_LEN> seed{};
+  std::array<uint8_t, raccoon256::SIG_BYTE_LEN> sig_bytes{};
+  std::vector<uint8_t> msg(fixed_msg_byte_len, 0);
+
+  prng::prng_t prng{};
+  prng.read(seed);
+  prng.read(msg);
+
+  auto skey = raccoon256::raccoon256_skey_t<num_shares>::generate(seed);
+  const auto pkey = skey.get_pkey();
+  skey.sign(msg, sig_bytes);
+
+  const std::string name = "/raccoon256_bench_" + std::to_string(getpid());
+  raccoon256::raccoon256_shm_matrix_cache_t::unlink(name);
+
+  const auto cache = raccoon256::raccoon256_shm_matrix_cache_t::open(name, 1);
+  const raccoon256::raccoon256_shm_pkey_t warm_pkey(*cache, pkey);
+
+  bool is_verified = true;
+  for (auto _ : state) {
+    if (is_shared) {
+      const raccoon256::raccoon256_shm_pkey_t shm_pkey(*cache, pkey);
+      is_verified &= shm_pkey.verify(msg, sig_bytes);
+    } else {
+      const raccoon256::raccoon256_prepared_pkey_t prepared_pkey(pkey);
+      is_verified &= prepared_pkey.verify(msg, sig_bytes);
+    }
+
+    benchmark::DoNotOptimize(is_verified);
+    benchmark::ClobberMemory();
+  }
+
+  raccoon256::raccoon256_shm_matrix_cache_t::unlink(name);
+  state.counters["segment_bytes"] = static_cast<double>(cache->get_byte_len());
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Benchmarks staged verification, using a prepared public key, fed with a corpus of adversarial (message, signature) pairs of given kind, reporting
+// average cycles spent in each stage of verification, per request.
+static void
+bench_raccoon256_verify_adversarial(benchmark::State& state)
+{
+  constexpr size_t fixed_msg_byte_len = 32;
+  constexpr size_t num_shares = 1;
+  constexpr size_t corpus_len = 64;
+  const auto kind = static_cast<corpus_kind_t>(state.range(0));
+
+  using sig_t = raccoon_sig::sig_t<raccoon256::𝜅, raccoon256::k, raccoon256::l, raccoon256::𝜈w, raccoon256::SIG_BYTE_LEN>;
+  using stage_t = raccoon256::raccoon256_verify_stage_t;
+
+  std::array<uint8_t, raccoon256::SEED_BYTE_LEN> seed{};
+  std::vector<std::vector<uint8_t>> msgs(corpus_len, std::vector<uint8_t>(fixed_msg_byte_len, 0));
+  std::vector<std::vector<uint8_t>> sigs(corpus_len, std::vector<uint8_t>(raccoon256::SIG_BYTE_LEN, 0));
+
+  prng::prng_t prng{};
+  prng.read(seed);
+
+  auto skey = raccoon256::raccoon256_skey_t<num_shares>::generate(seed);
+  auto pkey = raccoon256::raccoon256_prepared_pkey_t(skey.get_pkey());
+
+  for (size_t i = 0; i < corpus_len; i++) {
+    auto sig_span = std::span<uint8_t, raccoon256::SIG_BYTE_LEN>(sigs[i]);
+
+    prng.read(msgs[i]);
+    skey.sign(msgs[i], sig_span);
+
+    switch (kind) {
+      case corpus_kind_t::truncated:
+        sigs[i].pop_back();
+        break;
+      case corpus_kind_t::unary_run: {
+        std::array<uint8_t, sizeof(size_t)> rand_bytes{};
+        prng.read(rand_bytes);
+
+        // Long enough that, whichever coefficient it lands on, what's left of it, after the low bits, is an over-long unary run
+        constexpr size_t run_byte_len = 16;
+
+        const auto max_off = raccoon256::SIG_BYTE_LEN - raccoon256::MU_BYTE_LEN - run_byte_len;
+        const auto off = raccoon256::MU_BYTE_LEN + raccoon_utils::from_le_bytes<size_t>(rand_bytes) % max_off;
+        std::fill_n(sigs[i].begin() + static_cast<std::ptrdiff_t>(off), run_byte_len, 0xff);
+      } break;
+      case corpus_kind_t::out_of_bounds: {
+        const auto sig = sig_t::from_bytes(sig_span).value();
+        auto h = sig.get_h();
+        auto z = sig.get_z();
+
+        // A few coefficients of response vector are zeroed, so that the signature still fits
+        h[i % raccoon256::k][0][(i * 8) % raccoon_poly::N] = (raccoon256::Binf >> raccoon256::𝜈w) + 1;
+        for (size_t j = 0; j < 8; j++) {
+          z[0][0][j] = 0;
+        }
+
+        (void)sig_t(sig.get_c_hash(), h, z).to_bytes(sig_span);
+      } break;
+      case corpus_kind_t::forgery:
+        sigs[i][i % raccoon256::MU_BYTE_LEN] ^= 1;
+        break;
+      case corpus_kind_t::valid:
+        break;
+    }
+  }
+
+  std::array<uint64_t, static_cast<size_t>(stage_t::accepted)> stage_cycles{};
+  size_t num_rejected = 0;
+  size_t corpus_idx = 0;
+
+  for (auto _ : state) {
+    const auto report = pkey.verify_staged(msgs[corpus_idx], sigs[corpus_idx]);
+
+    for (size_t i = 0; i < stage_cycles.size(); i++) {
+      stage_cycles[i] += report.cycles[i];
+    }
+    num_rejected += !report.is_verified();
+    corpus_idx = (corpus_idx + 1) % corpus_len;
+
+    benchmark::DoNotOptimize(report);
+    benchmark::ClobberMemory();
+  }
+
+  const auto requests = static_cast<double>(state.iterations());
+  state.counters["rejected"] = static_cast<double>(num_rejected) / requests;
+  state.counters["cyc_size"] = static_cast<double>(stage_cycles[static_cast<size_t>(stage_t::size)]) / requests;
+  state.counters["cyc_decode"] = static_cast<double>(stage_cycles[static_cast<size_t>(stage_t::decode)]) / requests;
+  state.counters["cyc_norms"] = static_cast<double>(stage_cycles[static_cast<size_t>(stage_t::norms)]) / requests;
+  state.counters["cyc_challenge"] = static_cast<double>(stage_cycles[static_cast<size_t>(stage_t::challenge)]) / requests;
+  state.counters["cyc_commitment"] = static_cast<double>(stage_cycles[static_cast<size_t>(stage_t::commitment)]) / requests;
+
+  state.SetItemsProcessed(state.iterations());
+}
+
 BENCHMARK(bench_raccoon256_keygen<1>)->Name("raccoon256/keygen/1")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
 BENCHMARK(bench_raccoon256_keygen<2>)->Name("raccoon256/keygen/2")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
 BENCHMARK(bench_raccoon256_keygen<4>)->Name("raccoon256/keygen/4")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
@@ -99,4 +706,28 @@ BENCHMARK(bench_raccoon256_sign<8>)->Name("raccoon256/sign/8")->ComputeStatistic
 BENCHMARK(bench_raccoon256_sign<16>)->Name("raccoon256/sign/16")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
 BENCHMARK(bench_raccoon256_sign<32>)->Name("raccoon256/sign/32")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
 
+BENCHMARK(bench_raccoon256_sign_in_place<1>)->Name("raccoon256/sign_in_place/1")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_sign_in_place<2>)->Name("raccoon256/sign_in_place/2")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_sign_in_place<4>)->Name("raccoon256/sign_in_place/4")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_sign_in_place<8>)->Name("raccoon256/sign_in_place/8")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_sign_in_place<16>)->Name("raccoon256/sign_in_place/16")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_sign_in_place<32>)->Name("raccoon256/sign_in_place/32")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+
+BENCHMARK(bench_raccoon256_speculative_sign<1>)->Name("raccoon256/speculative_sign/1")->ArgName("attempts")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_speculative_sign<8>)->Name("raccoon256/speculative_sign/8")->ArgName("attempts")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_speculative_sign<32>)->Name("raccoon256/speculative_sign/32")->ArgName("attempts")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_sign_batch<1>)->Name("raccoon256/sign_batch/1")->ArgNames({ "batch", "threads" })->ArgsProduct({ { 64 }, { 0, 1, 2, 4 } })->UseRealTime()->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_sign_batch<8>)->Name("raccoon256/sign_batch/8")->ArgNames({ "batch", "threads" })->ArgsProduct({ { 64 }, { 0, 1, 2, 4 } })->UseRealTime()->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_sign_batch<32>)->Name("raccoon256/sign_batch/32")->ArgNames({ "batch", "threads" })->ArgsProduct({ { 64 }, { 0, 1, 2, 4 } })->UseRealTime()->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+
 BENCHMARK(bench_raccoon256_verify)->Name("raccoon256/verify")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_shared_verify)->Name("raccoon256/shared_verify")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_verify_streaming)->Name("raccoon256/verify_streaming")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_prepared_verify)->Name("raccoon256/prepared_verify")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_prepared_verify_vartime)->Name("raccoon256/prepared_verify_vartime")->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_verify_batch)->Name("raccoon256/verify_batch")->ArgName("batch")->RangeMultiplier(2)->Range(1, 256)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_verify_pool)->Name("raccoon256/verify_pool")->ArgName("threads")->RangeMultiplier(2)->Range(1, 64)->UseRealTime()->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_verify_cache)->Name("raccoon256/verify_cache")->ArgNames({ "threads", "shards" })->ArgsProduct({ { 1, 2, 4, 8 }, { 1, 16 } })->UseRealTime()->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_pkey_registry)->Name("raccoon256/pkey_registry")->ArgName("prepared")->Arg(4)->Arg(16)->Arg(64)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_shm_pkey_prepare)->Name("raccoon256/shm_pkey_prepare")->ArgName("shared")->Arg(0)->Arg(1)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
+BENCHMARK(bench_raccoon256_verify_adversarial)->Name("raccoon256/verify_adversarial")->ArgName("kind")->DenseRange(0, 4)->ComputeStatistics("min", compute_min)->ComputeStatistics("max", compute_max);
@@ -0,0 +1,270 @@
+#pragma once
+#include "public_key.hpp"
+#include "raccoon/internals/polynomial/challenge.hpp"
+#include "raccoon/internals/utility/thread_pool.hpp"
+#include "secret_key.hpp"
+#include <concepts>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <latch>
+#include <optional>
+#include <utility>
+
+// Asynchronous, C++20 coroutine based signing and verification, for callers which can't block their (event loop) thread
+namespace raccoon_async {
+
+// An executor is anything, which accepts a nullary task to be executed, at some later point of time, on some thread, e.g. `thread_pool_t`.
+template<typename E>
+concept executor_c = requires(E& ex, std::function<void()> task) { ex.submit(std::move(task)); };
+
+// Awaitable, which suspends awaiting coroutine and resumes it, on one of the threads of given executor.
+template<executor_c E>
+struct schedule_t
+{
+  E& ex;
+
+  bool await_ready() const noexcept { return false; }
+  void await_suspend(std::coroutine_handle<> handle) const { this->ex.submit([handle] { handle.resume(); }); }
+  void await_resume() const noexcept {}
+};
+
+// Resumes awaiting coroutine on given executor i.e. `co_await schedule_on(ex)` hops over to one of the threads of `ex`.
+template<executor_c E>
+schedule_t<E> schedule_on(E& ex)
+{
+  return schedule_t<E>{ ex };
+}
+
+// Process-wide executor, backing asynchronous signing and verification, unless caller supplies its own. Its worker threads are spawned, on first use, with
+// stack large enough for masked signing.
+inline raccoon_thread_pool::thread_pool_t&
+default_executor()
+{
+  static raccoon_thread_pool::thread_pool_t pool{};
+  return pool;
+}
+
+// Lazily started coroutine, producing a value of type T, which starts executing only when it is `co_await`-ed, and resumes the awaiting coroutine, on
+// completion, on whichever thread it completed on. Exception thrown from the coroutine body is rethrown in the awaiting coroutine.
+template<typename T>
+struct task_t
+{
+public:
+  struct promise_type
+  {
+    std::optional<T> value{};
+    std::exception_ptr error{};
+    std::coroutine_handle<> continuation = std::noop_coroutine();
+
+    struct final_awaiter_t
+    {
+      bool await_ready() const noexcept { return false; }
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) const noexcept { return handle.promise().continuation; }
+      void await_resume() const noexcept {}
+    };
+
+    task_t get_return_object() noexcept { return task_t(std::coroutine_handle<promise_type>::from_promise(*this)); }
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    final_awaiter_t final_suspend() const noexcept { return {}; }
+    void return_value(T v) { this->value.emplace(std::move(v)); }
+    void unhandled_exception() noexcept { this->error = std::current_exception(); }
+  };
+
+private:
+  std::coroutine_handle<promise_type> handle{};
+
+  explicit task_t(std::coroutine_handle<promise_type> handle)
+    : handle(handle)
+  {
+  }
+
+public:
+  task_t(task_t&& other) noexcept
+    : handle(std::exchange(other.handle, {}))
+  {
+  }
+
+  task_t(const task_t&) = delete;
+  task_t& operator=(const task_t&) = delete;
+  task_t& operator=(task_t&&) = delete;
+
+  ~task_t()
+  {
+    if (this->handle) {
+      this->handle.destroy();
+    }
+  }
+
+  bool await_ready() const noexcept { return false; }
+
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting)
+  {
+    this->handle.promise().continuation = awaiting;
+    return this->handle;
+  }
+
+  T await_resume()
+  {
+    auto& promise = this->handle.promise();
+    if (promise.error) {
+      std::rethrow_exception(promise.error);
+    }
+
+    return std::move(*promise.value);
+  }
+};
+
+namespace detail {
+
+// Eagerly started, self destroying coroutine, used for driving a task to completion, from non-coroutine code.
+struct detached_t
+{
+  struct promise_type
+  {
+    detached_t get_return_object() const noexcept { return {}; }
+    std::suspend_never initial_suspend() const noexcept { return {}; }
+    std::suspend_never final_suspend() const noexcept { return {}; }
+    void return_void() const noexcept {}
+    void unhandled_exception() const noexcept { std::terminate(); }
+  };
+};
+
+template<typename T>
+detached_t
+drive(task_t<T>& task, std::optional<T>& value, std::exception_ptr& error, std::latch& done)
+{
+  try {
+    value.emplace(co_await task);
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  done.count_down();
+}
+
+}
+
+// Blocks the calling thread, until the task completes, returning the value it produced. Meant for callers outside of any event loop, such as tests.
+template<typename T>
+T
+sync_wait(task_t<T> task)
+{
+  std::optional<T> value{};
+  std::exception_ptr error{};
+  std::latch done{ 1 };
+
+  detail::drive(task, value, error, done);
+  done.wait();
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  return std::move(*value);
+}
+
+// Asynchronous signer, using a prepared secret key, which must outlive the signer and all signing tasks started by it. Signing runs on the signer's
+// executor, yielding back to it between hashing the message, computing the commitment ( steps 4-9 of algorithm 2 of the specification ) and computing the
+// response, so that long masked operations of many concurrent signing tasks get interleaved, on executor's threads.
+template<size_t 𝜅, size_t k, size_t l, size_t d, size_t 𝜈t, size_t 𝑢w, size_t 𝜈w, size_t rep>
+struct signer_t
+{
+private:
+  using prepared_skey_t = raccoon_skey::prepared_skey_t<𝜅, k, l, d, 𝜈t>;
+
+  const prepared_skey_t& psk;
+  raccoon_thread_pool::thread_pool_t& ex;
+
+public:
+  // Constructor(s)
+  explicit signer_t(const prepared_skey_t& psk, raccoon_thread_pool::thread_pool_t& ex = default_executor())
+    : psk(psk)
+    , ex(ex)
+  {
+  }
+
+  // Signs a message, which must stay alive until the task completes, producing a byte serialized signature. Awaiting coroutine is resumed on the
+  // `completion` executor.
+  template<size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22, executor_c E>
+  task_t<std::array<uint8_t, sig_byte_len>> sign_async(std::span<const uint8_t> msg, E& completion) const
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    co_await schedule_on(this->ex);
+
+    // Step 2: Bind public key with message
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    raccoon_challenge::msg_hasher_t<𝜅> hasher(this->psk.get_pk_digest());
+    hasher.update(msg);
+    hasher.finalize(𝜇);
+
+    co_await schedule_on(this->ex);
+
+    // Steps 4-9: Message independent commitment, of the first signing attempt
+    auto presig = this->psk.template presign<𝑢w, 𝜈w, rep>();
+
+    co_await schedule_on(this->ex);
+
+    // Steps 10-20: Challenge and response, redoing the whole attempt inline, if rejected
+    std::array<uint8_t, sig_byte_len> sig_bytes{};
+    this->psk.template sign_digest<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(𝜇, sig_bytes, std::move(presig));
+
+    co_await schedule_on(completion);
+    co_return sig_bytes;
+  }
+
+  // Same as above, but awaiting coroutine is resumed on signer's own executor.
+  template<size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  task_t<std::array<uint8_t, sig_byte_len>> sign_async(std::span<const uint8_t> msg) const
+  {
+    return this->template sign_async<𝜔, sig_byte_len, Binf, B22>(msg, this->ex);
+  }
+};
+
+// Asynchronous verifier, using a prepared public key, which must outlive the verifier and all verification tasks started by it. Verification runs on
+// the verifier's executor, yielding back to it between hashing the message and verifying the signature.
+template<size_t 𝜅, size_t k, size_t l, size_t 𝜈t>
+struct verifier_t
+{
+private:
+  using prepared_pkey_t = raccoon_pkey::prepared_pkey_t<𝜅, k, l, 𝜈t>;
+
+  const prepared_pkey_t& ppk;
+  raccoon_thread_pool::thread_pool_t& ex;
+
+public:
+  // Constructor(s)
+  explicit verifier_t(const prepared_pkey_t& ppk, raccoon_thread_pool::thread_pool_t& ex = default_executor())
+    : ppk(ppk)
+    , ex(ex)
+  {
+  }
+
+  // Verifies a signature over a message, both of which must stay alive until the task completes, producing boolean truth value in case of success.
+  // Awaiting coroutine is resumed on the `completion` executor.
+  template<size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22, executor_c E>
+  task_t<bool> verify_async(std::span<const uint8_t> msg, std::span<const uint8_t, sig_byte_len> sig, E& completion) const
+  {
+    co_await schedule_on(this->ex);
+
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    raccoon_challenge::msg_hasher_t<𝜅> hasher(this->ppk.get_pk_digest());
+    hasher.update(msg);
+    hasher.finalize(𝜇);
+
+    co_await schedule_on(this->ex);
+
+    const bool is_valid = this->ppk.template verify_digest<𝜈w, 𝜔, sig_byte_len, Binf, B22>(𝜇, sig);
+
+    co_await schedule_on(completion);
+    co_return is_valid;
+  }
+
+  // Same as above, but awaiting coroutine is resumed on verifier's own executor.
+  template<size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  task_t<bool> verify_async(std::span<const uint8_t> msg, std::span<const uint8_t, sig_byte_len> sig) const
+  {
+    return this->template verify_async<𝜈w, 𝜔, sig_byte_len, Binf, B22>(msg, sig, this->ex);
+  }
+};
+
+}
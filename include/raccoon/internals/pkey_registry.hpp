@@ -0,0 +1,258 @@
+#pragma once
+#include "public_key.hpp"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Registry of many public keys, kept in their compact byte serialized form, with a bounded set of them kept prepared for verification
+namespace raccoon_pkey_registry {
+
+// Snapshot of the counters of a public key registry.
+struct registry_stats_t
+{
+  uint64_t hits = 0;      // Verifications, which found the public key already prepared
+  uint64_t misses = 0;    // Verifications, which had to prepare the public key first
+  uint64_t evictions = 0; // Least recently used prepared public keys, dropped to make room for new ones
+};
+
+// Registry of public keys, keyed by caller chosen identifier `id_t`. Each public key is held in its byte serialized form, which is about 1/ 9 -th of the
+// size of a decoded `pkey_t`, as coefficients of `t` carry only `Q_BIT_WIDTH - 𝜈t` significant bits. On demand, a public key is decoded and prepared for
+// verification ( see `prepared_pkey_t` ), keeping at most `max_prepared` -many of them, evicting the least recently used one, when full.
+//
+// Registry is safe to use from many threads. Prepared public keys are handed out as shared pointers, so that an in-flight verification keeps using its
+// prepared public key, even if it gets evicted meanwhile. Both preparation and verification run without holding the lock.
+template<size_t 𝜅,
+         size_t k,
+         size_t l,
+         size_t 𝜈t,
+         size_t 𝜈w,
+         size_t 𝜔,
+         size_t sig_byte_len,
+         uint64_t Binf,
+         uint64_t B22,
+         typename id_t,
+         typename id_hash_t = std::hash<id_t>>
+struct pkey_registry_t
+{
+public:
+  using pkey_t = raccoon_pkey::pkey_t<𝜅, k, 𝜈t>;
+  using prepared_pkey_t = raccoon_pkey::prepared_pkey_t<𝜅, k, l, 𝜈t>;
+
+  static constexpr size_t PKEY_BYTE_LEN = pkey_t::get_byte_len();
+
+private:
+  struct prepared_entry_t
+  {
+    id_t id{};
+    std::shared_ptr<const prepared_pkey_t> ppk{};
+  };
+
+  mutable std::mutex lock{};
+
+  // Byte serialized public keys, back-to-back, s.t. i-th slot is `packed[i * PKEY_BYTE_LEN, (i + 1) * PKEY_BYTE_LEN)`. Slots of erased public keys are
+  // reused by later insertions.
+  std::vector<uint8_t> packed{};
+  std::vector<size_t> free_slots{};
+  std::unordered_map<id_t, size_t, id_hash_t> slots{};
+
+  size_t max_prepared = 0;
+  std::list<prepared_entry_t> lru{};
+  std::unordered_map<id_t, typename std::list<prepared_entry_t>::iterator, id_hash_t> prepared_index{};
+
+  std::atomic<uint64_t> hits{ 0 };
+  std::atomic<uint64_t> misses{ 0 };
+  std::atomic<uint64_t> evictions{ 0 };
+
+  std::span<uint8_t, PKEY_BYTE_LEN> slot_bytes(const size_t slot)
+  {
+    return std::span<uint8_t, PKEY_BYTE_LEN>(this->packed.data() + slot * PKEY_BYTE_LEN, PKEY_BYTE_LEN);
+  }
+
+  // Drops prepared public key of given identifier, if any. Expects lock to be held.
+  void drop_prepared(const id_t& id)
+  {
+    const auto it = this->prepared_index.find(id);
+    if (it != this->prepared_index.end()) {
+      this->lru.erase(it->second);
+      this->prepared_index.erase(it);
+    }
+  }
+
+public:
+  // Creates a registry, which keeps at most `max_prepared` (>0) -many public keys prepared at once.
+  explicit pkey_registry_t(const size_t max_prepared)
+    : max_prepared(std::max<size_t>(max_prepared, 1))
+  {
+  }
+
+  pkey_registry_t(const pkey_registry_t&) = delete;
+  pkey_registry_t& operator=(const pkey_registry_t&) = delete;
+
+  // Inserts byte serialized public key under given identifier, replacing the one already registered under it, if any. Returns true, only if the identifier
+  // wasn't registered before.
+  bool insert(const id_t& id, std::span<const uint8_t, PKEY_BYTE_LEN> pk_bytes)
+  {
+    std::scoped_lock guard(this->lock);
+
+    bool is_new = false;
+    auto it = this->slots.find(id);
+
+    if (it == this->slots.end()) {
+      size_t slot = this->packed.size() / PKEY_BYTE_LEN;
+
+      if (this->free_slots.empty()) {
+        this->packed.resize(this->packed.size() + PKEY_BYTE_LEN);
+      } else {
+        slot = this->free_slots.back();
+        this->free_slots.pop_back();
+      }
+
+      it = this->slots.emplace(id, slot).first;
+      is_new = true;
+    } else {
+      this->drop_prepared(id);
+    }
+
+    std::copy(pk_bytes.begin(), pk_bytes.end(), this->slot_bytes(it->second).begin());
+    return is_new;
+  }
+
+  // Same as above, but given a public key.
+  bool insert(const id_t& id, const pkey_t& pkey)
+  {
+    std::array<uint8_t, PKEY_BYTE_LEN> pk_bytes{};
+    pkey.to_bytes(pk_bytes);
+
+    return this->insert(id, pk_bytes);
+  }
+
+  // Removes public key registered under given identifier, along with its prepared form. Returns true, only if it was registered.
+  bool erase(const id_t& id)
+  {
+    std::scoped_lock guard(this->lock);
+
+    const auto it = this->slots.find(id);
+    if (it == this->slots.end()) {
+      return false;
+    }
+
+    this->drop_prepared(id);
+    this->free_slots.push_back(it->second);
+    this->slots.erase(it);
+
+    return true;
+  }
+
+  // Checks whether any public key is registered under given identifier.
+  bool contains(const id_t& id) const
+  {
+    std::scoped_lock guard(this->lock);
+    return this->slots.contains(id);
+  }
+
+  // Number of registered public keys and number of them, which are currently prepared.
+  size_t size() const
+  {
+    std::scoped_lock guard(this->lock);
+    return this->slots.size();
+  }
+
+  size_t num_prepared() const
+  {
+    std::scoped_lock guard(this->lock);
+    return this->lru.size();
+  }
+
+  // Returns public key registered under given identifier, prepared for verification, preparing it on a miss and evicting the least recently used prepared
+  // public key, if already full. Returns null, if no public key is registered under given identifier.
+  std::shared_ptr<const prepared_pkey_t> prepared(const id_t& id)
+  {
+    std::array<uint8_t, PKEY_BYTE_LEN> pk_bytes{};
+
+    {
+      std::scoped_lock guard(this->lock);
+
+      const auto it = this->prepared_index.find(id);
+      if (it != this->prepared_index.end()) {
+        this->lru.splice(this->lru.begin(), this->lru, it->second);
+        this->hits.fetch_add(1, std::memory_order_relaxed);
+
+        return it->second->ppk;
+      }
+
+      const auto slot = this->slots.find(id);
+      if (slot == this->slots.end()) {
+        return nullptr;
+      }
+
+      const auto bytes = this->slot_bytes(slot->second);
+      std::copy(bytes.begin(), bytes.end(), pk_bytes.begin());
+    }
+
+    this->misses.fetch_add(1, std::memory_order_relaxed);
+
+    // Expands public matrix A, without holding the lock
+    auto ppk = std::make_shared<const prepared_pkey_t>(pkey_t::from_bytes(pk_bytes));
+
+    std::scoped_lock guard(this->lock);
+
+    // Public key may have been replaced or erased, while it was being prepared, in which case the prepared one is handed out, but not kept
+    const auto slot = this->slots.find(id);
+    if ((slot == this->slots.end()) || !std::ranges::equal(this->slot_bytes(slot->second), pk_bytes)) {
+      return ppk;
+    }
+
+    // Some other caller may have prepared the same public key, in the meantime
+    const auto it = this->prepared_index.find(id);
+    if (it != this->prepared_index.end()) {
+      return it->second->ppk;
+    }
+
+    if (this->lru.size() == this->max_prepared) {
+      this->prepared_index.erase(this->lru.back().id);
+      this->lru.pop_back();
+      this->evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    this->lru.push_front(prepared_entry_t{ id, ppk });
+    this->prepared_index.emplace(id, this->lru.begin());
+
+    return ppk;
+  }
+
+  // Verifies a (message, signature) pair under the public key, registered under given identifier, using its prepared form. Returns false, if no public key
+  // is registered under given identifier. Otherwise, outcome of verification is same as that of `pkey_t::verify`.
+  bool verify(const id_t& id, std::span<const uint8_t> msg, std::span<const uint8_t, sig_byte_len> sig)
+  {
+    const auto ppk = this->prepared(id);
+    if (!ppk) {
+      return false;
+    }
+
+    return ppk->template verify<𝜈w, 𝜔, sig_byte_len, Binf, B22>(msg, sig);
+  }
+
+  // Returns a snapshot of the counters, accumulated since creation of the registry or since last call to `reset_stats`.
+  registry_stats_t stats() const
+  {
+    return registry_stats_t{
+      .hits = this->hits.load(std::memory_order_relaxed),
+      .misses = this->misses.load(std::memory_order_relaxed),
+      .evictions = this->evictions.load(std::memory_order_relaxed),
+    };
+  }
+
+  void reset_stats()
+  {
+    this->hits.store(0, std::memory_order_relaxed);
+    this->misses.store(0, std::memory_order_relaxed);
+    this->evictions.store(0, std::memory_order_relaxed);
+  }
+};
+
+}
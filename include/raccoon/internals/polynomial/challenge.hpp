@@ -5,54 +5,110 @@
 // Challenge computation
 namespace raccoon_challenge {
 
-// Computes `2 * 𝜅` -bit digest of the commitment vector `w` and message, to be signed, hash 𝜇 (which is bound to the public key),
-// following algorithm 9 of the Raccoon specification.
-template<size_t k, size_t 𝜅>
+// Computes `2 * 𝜅` -bit digest of the byte serialized public key, which is used for binding public key with message, following step 2 of
+// algorithm 2 (and step 3 of algorithm 3) of the Raccoon specification.
+template<size_t 𝜅>
 constexpr void
-chal_hash(const raccoon_poly_vec::poly_vec_t<k, 1>& w,
-          std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇,
-          std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash)
+pk_hash(std::span<const uint8_t> pk_bytes, std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> pk_digest)
 {
-  shake256::shake256_t xof;
+  shake256::shake256_t hasher{};
+  hasher.absorb(pk_bytes);
+  hasher.finalize();
+  hasher.squeeze(pk_digest);
+}
 
-  std::array<uint8_t, shake256::RATE / std::numeric_limits<uint8_t>::digits> buffer{};
-  auto _buffer = std::span(buffer);
-  size_t buf_off = 0;
+// Incrementally binds message with the public key, given `2 * 𝜅` -bit digest of the public key, s.t. message can be absorbed in arbitrary many chunks,
+// before producing `2 * 𝜅` -bit digest 𝜇, following step 2 of algorithm 2 (and step 3 of algorithm 3) of the Raccoon specification.
+template<size_t 𝜅>
+struct msg_hasher_t
+{
+private:
+  shake256::shake256_t hasher{};
 
-  std::array<uint8_t, sizeof(uint64_t)> hdr{};
-  hdr[0] = 'h';
-  hdr[1] = k;
+public:
+  // Constructor(s)
+  constexpr msg_hasher_t() = default;
+  explicit constexpr msg_hasher_t(std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> pk_digest) { this->hasher.absorb(pk_digest); }
 
-  std::copy(hdr.begin(), hdr.end(), _buffer.begin());
-  buf_off += hdr.size();
+  // Absorbs next chunk of the message. Must not be called after `finalize`.
+  constexpr void update(std::span<const uint8_t> msg_chunk) { this->hasher.absorb(msg_chunk); }
 
-  constexpr size_t coeff_cnt = k * raccoon_poly::N;
-  size_t w_idx = 0;
+  // Produces digest 𝜇, of the message absorbed so far. Must be called only once.
+  constexpr void finalize(std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇)
+  {
+    this->hasher.finalize();
+    this->hasher.squeeze(𝜇);
+  }
+};
 
-  while (w_idx < coeff_cnt) {
-    if (buf_off == _buffer.size()) {
-      xof.absorb(_buffer);
-      buf_off = 0;
-    }
+// Binds message with the public key, given `2 * 𝜅` -bit digest of the public key, producing `2 * 𝜅` -bit digest 𝜇, following step 2 of algorithm 2
+// (and step 3 of algorithm 3) of the Raccoon specification.
+template<size_t 𝜅>
+constexpr void
+msg_hash(std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> pk_digest,
+         std::span<const uint8_t> msg,
+         std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇)
+{
+  msg_hasher_t<𝜅> hasher(pk_digest);
+  hasher.update(msg);
+  hasher.finalize(𝜇);
+}
+
+// Incrementally computes `2 * 𝜅` -bit digest of the commitment vector `w` and message hash 𝜇, following algorithm 9 of the Raccoon specification, s.t.
+// `w` can be absorbed one row at a time, as soon as that row gets computed.
+template<size_t k, size_t 𝜅>
+struct chal_hasher_t
+{
+private:
+  shake256::shake256_t xof{};
+
+public:
+  // Constructor(s)
+  constexpr chal_hasher_t()
+  {
+    std::array<uint8_t, sizeof(uint64_t)> hdr{};
+    hdr[0] = 'h';
+    hdr[1] = k;
+
+    this->xof.absorb(hdr);
+  }
 
-    const size_t row_idx = w_idx / raccoon_poly::N;
-    const size_t coeff_idx = w_idx % raccoon_poly::N;
+  // Absorbs next row of commitment vector `w`, keeping only lowest byte of each coefficient. Must be called exactly `k` times, in order of rows.
+  constexpr void update(const raccoon_poly::poly_t& w_row)
+  {
+    std::array<uint8_t, raccoon_poly::N> row_bytes{};
+    for (size_t i = 0; i < row_bytes.size(); i++) {
+      row_bytes[i] = static_cast<uint8_t>(w_row[i].raw());
+    }
 
-    _buffer[buf_off] = static_cast<uint8_t>(w[row_idx][0][coeff_idx].raw());
+    this->xof.absorb(row_bytes);
+  }
 
-    buf_off++;
-    w_idx++;
+  // Absorbs message hash 𝜇 and produces challenge hash. Must be called only once.
+  constexpr void finalize(std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇,
+                          std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash)
+  {
+    this->xof.absorb(𝜇);
+    this->xof.finalize();
+    this->xof.squeeze(c_hash);
   }
+};
+
+// Computes `2 * 𝜅` -bit digest of the commitment vector `w` and message, to be signed, hash 𝜇 (which is bound to the public key),
+// following algorithm 9 of the Raccoon specification.
+template<size_t k, size_t 𝜅>
+constexpr void
+chal_hash(const raccoon_poly_vec::poly_vec_t<k, 1>& w,
+          std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇,
+          std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash)
+{
+  chal_hasher_t<k, 𝜅> hasher{};
 
-  if (buf_off > 0) {
-    xof.absorb(_buffer.subspan(0, buf_off));
-    buf_off = 0;
+  for (size_t ridx = 0; ridx < k; ridx++) {
+    hasher.update(w[ridx][0]);
   }
 
-  xof.absorb(𝜇);
-  xof.finalize();
-  xof.squeeze(c_hash);
-  xof.reset();
+  hasher.finalize(𝜇, c_hash);
 }
 
 }
@@ -13,47 +13,59 @@ private:
   std::array<raccoon_poly::poly_t, d> shares{};
 
   // Given a 64 -bit header and `𝜅` -bits seed as input, this routine is used for uniform sampling a polynomial s.t. each of its
-  // coefficients ∈ [-2^(u-1), 2^(u-1)), following algorithm 7 of https://raccoonfamily.org/wp-content/uploads/2023/07/raccoon.pdf.
+  // coefficients ∈ [-2^(u-1), 2^(u-1)), following algorithm 7 of https://raccoonfamily.org/wp-content/uploads/2023/07/raccoon.pdf,
+  // while adding sampled polynomial to `f`, whose coefficients ∈ [0, Q), keeping resulting coefficients reduced modulo Q.
+  //
+  // Sampled polynomial is never materialized. Instead XOF output is squeezed in blocks of `block_coeff_cnt` coefficients and each
+  // block is unpacked using a branchless sign-extension, which is friendly to auto-vectorization, before being added to `f`.
   template<size_t u, size_t 𝜅>
-  static constexpr std::array<int64_t, raccoon_poly::N> sampleU(std::span<const uint8_t, std::numeric_limits<uint8_t>::digits> hdr,
-                                                                std::span<const uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits> 𝜎)
-    requires(u > 0)
+  static constexpr void sampleU_and_add(raccoon_poly::poly_t& f,
+                                        std::span<const uint8_t, std::numeric_limits<uint8_t>::digits> hdr,
+                                        std::span<const uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits> 𝜎)
+    requires((u > 0) && (u < field::Q_BIT_WIDTH))
   {
-    std::array<int64_t, raccoon_poly::N> f{};
-
     constexpr size_t squeezed_bytes_per_coeff = (u + 7) / 8;
-    constexpr size_t total_squeezed_bytes = squeezed_bytes_per_coeff * f.size();
+    constexpr size_t block_coeff_cnt = 64;
+    constexpr size_t sign_extension_shift = std::numeric_limits<uint64_t>::digits - u;
+
+    static_assert(raccoon_poly::N % block_coeff_cnt == 0, "Block size must evenly divide number of coefficients !");
 
-    std::array<uint8_t, total_squeezed_bytes> squeezed_bytes{};
-    auto squeezed_bytes_span = std::span(squeezed_bytes);
+    std::array<uint8_t, squeezed_bytes_per_coeff * block_coeff_cnt> squeezed_bytes{};
 
     shake256::shake256_t xof{};
     xof.absorb(hdr);
     xof.absorb(𝜎);
     xof.finalize();
-    xof.squeeze(squeezed_bytes_span);
 
-    constexpr uint64_t mask_msb = 1ul << (u - 1);
-    constexpr uint64_t mask_lsb = mask_msb - 1;
-
-    size_t offset = 0;
-    size_t coeff_idx = 0;
+    for (size_t block_off = 0; block_off < f.num_coeffs(); block_off += block_coeff_cnt) {
+      xof.squeeze(squeezed_bytes);
+
+#if defined __clang__
+#pragma clang loop unroll(enable) vectorize(enable) interleave(enable)
+#elif defined __GNUG__
+#pragma GCC unroll 16
+#pragma GCC ivdep
+#endif
+      for (size_t i = 0; i < block_coeff_cnt; i++) {
+        uint64_t word = 0;
+        for (size_t j = 0; j < squeezed_bytes_per_coeff; j++) {
+          word |= static_cast<uint64_t>(squeezed_bytes[i * squeezed_bytes_per_coeff + j]) << (j * std::numeric_limits<uint8_t>::digits);
+        }
 
-    while (offset < total_squeezed_bytes) {
-      auto b = squeezed_bytes_span.subspan(offset, squeezed_bytes_per_coeff);
-      const uint64_t b_word = raccoon_utils::from_le_bytes<uint64_t>(b);
+        // Sign-extend low `u` -bits of the word, same as computing `lsb - msb` s.t. msb is u-th bit and lsb are lower (u-1) -bits.
+        const auto noise = static_cast<int64_t>(word << sign_extension_shift) >> sign_extension_shift;
 
-      const auto msb = static_cast<int64_t>(b_word & mask_msb);
-      const auto lsb = static_cast<int64_t>(b_word & mask_lsb);
+        // Resulting coefficient ∈ (-Q, 2*Q), bring it back to [0, Q), without branching.
+        const auto coeff = static_cast<int64_t>(f[block_off + i].raw()) + noise;
+        const auto lifted_coeff = static_cast<uint64_t>(coeff + static_cast<int64_t>(field::Q & static_cast<uint64_t>(coeff >> 63)));
 
-      const auto f_coeff = lsb - msb;
-      f[coeff_idx] = f_coeff;
+        const auto t = lifted_coeff - field::Q;
+        const auto mask = -(t >> 63);
+        const auto normalized_coeff = t + (field::Q & mask);
 
-      offset += squeezed_bytes_per_coeff;
-      coeff_idx++;
+        f[block_off + i] = field::zq_t(normalized_coeff);
+      }
     }
-
-    return f;
   }
 
 public:
@@ -275,18 +287,7 @@ public:
         prng.read(𝜎);
 
         std::array<const uint8_t, 8> hdr_u{ static_cast<uint8_t>('u'), static_cast<uint8_t>(i_rep), static_cast<uint8_t>(idx), static_cast<uint8_t>(sidx) };
-        const auto poly_u = sampleU<u, 𝜅>(hdr_u, 𝜎);
-
-        for (size_t coeff_idx = 0; coeff_idx < poly_u.size(); coeff_idx++) {
-          const auto coeff = static_cast<int64_t>((*this)[sidx][coeff_idx].raw()) + poly_u[coeff_idx];
-
-          const auto is_lt_zero = -(static_cast<uint64_t>(coeff) >> ((sizeof(coeff) * 8) - 1));
-          const auto is_ge_q = subtle::ct_ge<uint64_t, uint64_t>(static_cast<uint64_t>(coeff & ~is_lt_zero), field::Q);
-
-          const auto normalized_coeff = static_cast<uint64_t>(static_cast<int64_t>(field::Q & is_lt_zero) + coeff - static_cast<int64_t>(field::Q & is_ge_q));
-
-          (*this)[sidx][coeff_idx] = field::zq_t(normalized_coeff);
-        }
+        sampleU_and_add<u, 𝜅>((*this)[sidx], hdr_u, 𝜎);
       }
 
       this->refresh(mrng);
@@ -3,6 +3,7 @@
 #include "raccoon/internals/rng/mrng.hpp"
 #include "raccoon/internals/rng/prng.hpp"
 #include "raccoon/internals/utility/force_inline.hpp"
+#include "raccoon/internals/utility/timing.hpp"
 #include "raccoon/internals/utility/utils.hpp"
 #include "shake256.hpp"
 #include <algorithm>
@@ -463,7 +464,11 @@ public:
 
   // Expands a `2 * 𝜅` -bit challenge hash into a polynomial such that exactly `𝜔` -many of coefficients are set to +1/ -1,
   // while others are set to 0, following algorithm 10 of the Raccoon specification.
-  template<size_t 𝜅, size_t 𝜔>
+  //
+  // XOF output is squeezed one rate-sized block at a time and consumed two bytes per candidate position, using a cursor. Each candidate
+  // is inserted by sweeping over all coefficients, so that memory access pattern doesn't depend on the candidate position, unless variable-time
+  // execution is requested, in which case candidate position is directly indexed.
+  template<size_t 𝜅, size_t 𝜔, raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
   static constexpr poly_t chal_poly(std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash)
   {
     shake256::shake256_t xof{};
@@ -473,24 +478,56 @@ public:
     xof.absorb(c_hash);
     xof.finalize();
 
+    std::array<uint8_t, shake256::RATE / std::numeric_limits<uint8_t>::digits> buf{};
+    auto buf_span = std::span(buf);
+
+    static_assert(buf.size() % sizeof(uint16_t) == 0, "Squeezed block must hold whole number of candidate positions !");
+
+    xof.squeeze(buf_span);
+    size_t buf_off = 0;
+
     constexpr uint16_t mask = (1u << LOG2N) - 1;
 
     poly_t c_poly{};
     size_t non_zero_coeff_cnt = 0;
 
     while (non_zero_coeff_cnt < 𝜔) {
-      std::array<uint8_t, sizeof(uint16_t)> b{};
-      xof.squeeze(b);
+      if (buf_off == buf_span.size()) {
+        xof.squeeze(buf_span);
+        buf_off = 0;
+      }
 
-      const auto b_word = raccoon_utils::from_le_bytes<uint16_t>(b);
-      const auto b_0 = b_word & 0b1u;
-      const uint16_t i = static_cast<uint16_t>(b_word >> 1u) & mask;
+      const auto b_word = raccoon_utils::from_le_bytes<uint16_t>(buf_span.subspan(buf_off, sizeof(uint16_t)));
+      buf_off += sizeof(uint16_t);
 
-      const auto cond = c_poly[i] == 0;
-      const field::zq_t branch[] = { c_poly[i], field::zq_t::one() - field::zq_t(2 * b_0) };
+      const auto b_0 = static_cast<uint64_t>(b_word & 0b1u);
+      const auto i = static_cast<uint64_t>(b_word >> 1u) & mask;
+      const auto v = (field::zq_t::one() - field::zq_t(2 * b_0)).raw();
 
-      c_poly[i] = branch[cond];
-      non_zero_coeff_cnt += static_cast<size_t>(cond);
+      if constexpr (raccoon_timing::is_variable_time<timing_t>) {
+        if (c_poly[i].raw() == 0) {
+          c_poly[i] = field::zq_t(v);
+          non_zero_coeff_cnt++;
+        }
+      } else {
+        uint64_t inserted = 0;
+
+#if defined __clang__
+#pragma clang loop unroll(enable) vectorize(enable) interleave(enable)
+#endif
+        for (size_t j = 0; j < c_poly.num_coeffs(); j++) {
+          const auto coeff = c_poly[j].raw();
+
+          const auto is_target = -static_cast<uint64_t>(static_cast<uint64_t>(j) == i);
+          const auto is_zero = -static_cast<uint64_t>(coeff == 0);
+          const auto selected = is_target & is_zero;
+
+          c_poly[j] = field::zq_t((v & selected) | (coeff & ~selected));
+          inserted |= selected;
+        }
+
+        non_zero_coeff_cnt += static_cast<size_t>(inserted & 0b1u);
+      }
     }
 
     return c_poly;
@@ -28,16 +28,49 @@ public:
   constexpr raccoon_poly_vec::poly_vec_t<rows, d> operator*(const raccoon_poly_vec::poly_vec_t<cols, d>& rhs) const
   {
     raccoon_poly_vec::poly_vec_t<rows, d> res{};
+    this->multiply(rhs, res);
 
+    return res;
+  }
+
+  // Same as above, but writes the resulting vector into caller supplied one, overwriting whatever it holds.
+  template<size_t d>
+  constexpr void multiply(const raccoon_poly_vec::poly_vec_t<cols, d>& rhs, raccoon_poly_vec::poly_vec_t<rows, d>& res) const
+  {
     for (size_t row_idx = 0; row_idx < this->num_rows(); row_idx++) {
-      for (size_t col_idx = 0; col_idx < this->num_cols(); col_idx++) {
+      for (size_t shr_idx = 0; shr_idx < d; shr_idx++) {
+        res[row_idx][shr_idx] = (*this)[{ row_idx, 0 }] * rhs[0][shr_idx];
+      }
+
+      for (size_t col_idx = 1; col_idx < this->num_cols(); col_idx++) {
         for (size_t shr_idx = 0; shr_idx < d; shr_idx++) {
           res[row_idx][shr_idx] += (*this)[{ row_idx, col_idx }] * rhs[col_idx][shr_idx];
         }
       }
     }
+  }
 
-    return res;
+  // Multiplies the matrix with `count` (<= B) -many column vectors at once i.e. computes `[y_0 .. y_{count-1}] = A · [z_0 .. z_{count-1}]`, s.t. all of
+  // them are in their NTT representation. Each polynomial of the matrix is loaded once and multiplied with respective elements of all the vectors, while
+  // it's still hot in cache, instead of streaming the whole matrix from memory, once per vector.
+  template<size_t B>
+  constexpr void multiply_batch(const std::array<raccoon_poly_vec::poly_vec_t<cols, 1>, B>& zs,
+                                std::array<raccoon_poly_vec::poly_vec_t<rows, 1>, B>& ys,
+                                const size_t count) const
+  {
+    for (size_t row_idx = 0; row_idx < this->num_rows(); row_idx++) {
+      const auto& a0 = (*this)[{ row_idx, 0 }];
+      for (size_t vec_idx = 0; vec_idx < count; vec_idx++) {
+        ys[vec_idx][row_idx][0] = a0 * zs[vec_idx][0][0];
+      }
+
+      for (size_t col_idx = 1; col_idx < this->num_cols(); col_idx++) {
+        const auto& a = (*this)[{ row_idx, col_idx }];
+        for (size_t vec_idx = 0; vec_idx < count; vec_idx++) {
+          ys[vec_idx][row_idx][0] += a * zs[vec_idx][col_idx][0];
+        }
+      }
+    }
   }
 
   // Given `𝜅` -bits seed as input, this routine is used for generating public matrix A, following algorithm 6 of
@@ -46,15 +79,31 @@ public:
   static constexpr poly_mat_t<k, l> expandA(std::span<const uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits> seed)
   {
     poly_mat_t<k, l> A{};
+    expandA<k, l, 𝜅>(seed, A);
+
+    return A;
+  }
 
+  // Same as above, but writes public matrix A into caller supplied one, overwriting whatever it holds.
+  template<size_t k, size_t l, size_t 𝜅>
+  static constexpr void expandA(std::span<const uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits> seed, poly_mat_t<k, l>& A)
+  {
     for (size_t ridx = 0; ridx < k; ridx++) {
       for (size_t cidx = 0; cidx < l; cidx++) {
-        std::array<const uint8_t, 8> hdr{ static_cast<uint8_t>('A'), static_cast<uint8_t>(ridx), static_cast<uint8_t>(cidx) };
-        A[{ ridx, cidx }] = raccoon_poly::poly_t::sampleQ<𝜅>(hdr, seed);
+        A[{ ridx, cidx }] = expandA_elem<𝜅>(seed, ridx, cidx);
       }
     }
+  }
 
-    return A;
+  // Generates only the element at (ridx, cidx) of public matrix A, which is already in its NTT representation, so that rows of A can be consumed as
+  // they are generated, without ever materializing the whole matrix.
+  template<size_t 𝜅>
+  static constexpr raccoon_poly::poly_t expandA_elem(std::span<const uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits> seed,
+                                                     const size_t ridx,
+                                                     const size_t cidx)
+  {
+    std::array<const uint8_t, 8> hdr{ static_cast<uint8_t>('A'), static_cast<uint8_t>(ridx), static_cast<uint8_t>(cidx) };
+    return raccoon_poly::poly_t::sampleQ<𝜅>(hdr, seed);
   }
 };
 
@@ -76,6 +76,16 @@ public:
     return res;
   }
 
+  // Adds `rhs * c` to this column vector, in place, without materializing the product, s.t. `rhs` and `c` are both in their NTT representation.
+  constexpr void add_scaled(const poly_vec_t& rhs, const raccoon_poly::poly_t& c)
+  {
+    for (size_t ridx = 0; ridx < this->num_rows(); ridx++) {
+      for (size_t sidx = 0; sidx < d; sidx++) {
+        (*this)[ridx][sidx] += rhs[ridx][sidx] * c;
+      }
+    }
+  }
+
   // Multiplication by a polynomial s.t. both polynomial vector (LHS input) and polynomial (RHS input) are in their NTT representation.
   constexpr poly_vec_t operator*(const raccoon_poly::poly_t& rhs) const
   {
@@ -152,6 +162,14 @@ public:
     return vec;
   }
 
+  // Same as above, but overwrites this column vector with a masked encoding of zero, in place.
+  constexpr void fill_zero_encoding(mrng::mrng_t<d>& mrng)
+  {
+    for (size_t ridx = 0; ridx < this->num_rows(); ridx++) {
+      (*this)[ridx].zero_encoding(mrng);
+    }
+  }
+
   // Returns a fresh d -sharing of the input polynomial vector, using `zero_encoding` as a subroutine.
   //
   // This is an implementation of algorithm 11 of the Raccoon specification, extended for masked polynomial vectors.
@@ -0,0 +1,149 @@
+#pragma once
+#include "raccoon/internals/polynomial/poly_vec.hpp"
+#include "raccoon/internals/workspace.hpp"
+#include <condition_variable>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+
+// Offline/ online signing, using precomputed commitments
+namespace raccoon_presig {
+
+// Message independent commitment of Raccoon signing algorithm, computed by steps 4-9 of algorithm 2 of the specification, which is
+// - masked vector `[[r]]`, in its NTT representation
+// - rounded, unmasked commitment vector `w'`
+// - digest of the public key, under whose matrix A the commitment was computed, as it's of no use for signing under any other key
+//
+// A presignature must be consumed by exactly one signing attempt, hence it is neither copyable nor reusable, once moved out of a pool.
+template<size_t 𝜅, size_t k, size_t l, size_t d>
+struct presig_t
+{
+  raccoon_poly_vec::poly_vec_t<l, d> r{};
+  raccoon_poly_vec::poly_vec_t<k, 1> w_prime{};
+  std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> pk_digest{};
+
+  constexpr presig_t() = default;
+  presig_t(const presig_t&) = delete;
+  presig_t& operator=(const presig_t&) = delete;
+};
+
+// Bounded, thread-safe pool of heap allocated presignatures, which is filled by one or more producer (worker) threads, while online signing consumes one
+// presignature per signing attempt. Each presignature is handed out exactly once, by transferring its ownership. As `[[r]]` is an ephemeral secret, each
+// presignature is wiped, when released, be it after being consumed or along with the pool, still holding it.
+//
+// A pool is meant to be filled and drained by a single key. Each presignature carries digest of the public key, it was computed under, which is checked,
+// when it's consumed.
+template<size_t 𝜅, size_t k, size_t l, size_t d>
+struct presig_pool_t
+{
+public:
+  using presig_ptr_t = raccoon_workspace::secure_ptr_t<presig_t<𝜅, k, l, d>>;
+
+private:
+  std::deque<presig_ptr_t> entries{};
+  size_t cap = 0;
+
+  mutable std::mutex lock{};
+  std::condition_variable_any not_full{};
+  std::condition_variable_any not_empty{};
+
+public:
+  // Constructor(s)
+  explicit presig_pool_t(const size_t capacity)
+    : cap(capacity)
+  {
+  }
+
+  presig_pool_t(const presig_pool_t&) = delete;
+  presig_pool_t& operator=(const presig_pool_t&) = delete;
+
+  // Maximum number of presignatures, which can be held in the pool.
+  size_t capacity() const { return this->cap; }
+
+  // Number of presignatures, currently available in the pool.
+  size_t size() const
+  {
+    std::scoped_lock guard(this->lock);
+    return this->entries.size();
+  }
+
+  // Is the pool already holding as many presignatures as it can hold ?
+  bool full() const { return this->size() >= this->cap; }
+
+  // Attempts to add a presignature to the pool, without blocking. Returns false if the pool is already full, in which case presignature is dropped.
+  bool try_push(presig_ptr_t presig)
+  {
+    {
+      std::scoped_lock guard(this->lock);
+      if (this->entries.size() >= this->cap) {
+        return false;
+      }
+
+      this->entries.push_back(std::move(presig));
+    }
+
+    this->not_empty.notify_one();
+    return true;
+  }
+
+  // Adds a presignature to the pool, blocking while the pool is full. Returns false if stop was requested before there was space, in which case
+  // presignature is dropped.
+  bool push(presig_ptr_t presig, std::stop_token stoken)
+  {
+    {
+      std::unique_lock guard(this->lock);
+      if (!this->not_full.wait(guard, stoken, [this] { return this->entries.size() < this->cap; })) {
+        return false;
+      }
+
+      this->entries.push_back(std::move(presig));
+    }
+
+    this->not_empty.notify_one();
+    return true;
+  }
+
+  // Attempts to take a presignature out of the pool, without blocking. Returns nullptr if the pool is empty.
+  presig_ptr_t try_pop()
+  {
+    presig_ptr_t presig{};
+
+    {
+      std::scoped_lock guard(this->lock);
+      if (this->entries.empty()) {
+        return presig;
+      }
+
+      presig = std::move(this->entries.front());
+      this->entries.pop_front();
+    }
+
+    this->not_full.notify_one();
+    return presig;
+  }
+
+  // Takes a presignature out of the pool, blocking while the pool is empty. Returns nullptr if stop was requested before any presignature was available.
+  presig_ptr_t pop(std::stop_token stoken)
+  {
+    presig_ptr_t presig{};
+
+    {
+      std::unique_lock guard(this->lock);
+      if (!this->not_empty.wait(guard, stoken, [this] { return !this->entries.empty(); })) {
+        return presig;
+      }
+
+      presig = std::move(this->entries.front());
+      this->entries.pop_front();
+    }
+
+    this->not_full.notify_one();
+    return presig;
+  }
+};
+
+}
@@ -3,15 +3,45 @@
 #include "raccoon/internals/polynomial/challenge.hpp"
 #include "raccoon/internals/polynomial/poly_mat.hpp"
 #include "raccoon/internals/polynomial/poly_vec.hpp"
+#include "raccoon/internals/utility/cycles.hpp"
 #include "raccoon/internals/utility/serialization.hpp"
+#include "raccoon/internals/utility/timing.hpp"
 #include "raccoon/internals/utility/utils.hpp"
+#include "raccoon/internals/workspace.hpp"
 #include "shake256.hpp"
 #include "signature.hpp"
+#include <algorithm>
 #include <array>
 #include <cstdint>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
 
 namespace raccoon_pkey {
 
+// Stages of verification, ordered by their cost, s.t. an invalid signature gets rejected by the cheapest stage, which can tell so.
+enum class verify_stage_t : uint8_t
+{
+  size,       // Byte length of the signature
+  decode,     // Canonical decoding of the signature, including its zero padding
+  norms,      // Norms check of decoded hint and response vectors
+  challenge,  // Binding public key with message and computing challenge polynomial, never rejects
+  commitment, // Recomputing commitment, using public matrix A, and checking it against challenge hash
+  accepted,   // Signature is valid
+};
+
+// Outcome of staged verification i.e. the stage, which rejected the signature ( or `accepted` ), along with cycles ( see `raccoon_cycles::now` ) spent in
+// each stage. Stages after the rejecting one are never run, hence they report zero cycles.
+struct verify_report_t
+{
+  verify_stage_t stage = verify_stage_t::size;
+  std::array<uint64_t, static_cast<size_t>(verify_stage_t::accepted)> cycles{};
+
+  constexpr bool is_verified() const { return this->stage == verify_stage_t::accepted; }
+  constexpr uint64_t stage_cycles(const verify_stage_t stage) const { return this->cycles[static_cast<size_t>(stage)]; }
+  constexpr uint64_t total_cycles() const { return std::accumulate(this->cycles.begin(), this->cycles.end(), uint64_t{ 0 }); }
+};
+
 // Raccoon Public Key
 template<size_t 𝜅, size_t k, size_t 𝜈t>
 struct pkey_t
@@ -52,80 +82,346 @@ public:
     return res;
   }
 
+  // Computes `2 * 𝜅` -bit digest of the byte serialized public key, which prefixes the message when computing 𝜇.
+  constexpr void hash(std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> pk_digest) const
+  {
+    std::array<uint8_t, get_byte_len()> pk_bytes{};
+    this->to_bytes(pk_bytes);
+
+    raccoon_challenge::pk_hash<𝜅>(pk_bytes, pk_digest);
+  }
+
+  // Expands seed into public matrix A, which is already in its NTT representation.
+  template<size_t l>
+  constexpr raccoon_poly_mat::poly_mat_t<k, l> expand_A() const
+  {
+    return raccoon_poly_mat::poly_mat_t<k, l>::template expandA<k, l, 𝜅>(this->seed);
+  }
+
+  // Same as above, but writes public matrix A into caller supplied one.
+  template<size_t l>
+  constexpr void expand_A(raccoon_poly_mat::poly_mat_t<k, l>& A) const
+  {
+    raccoon_poly_mat::poly_mat_t<k, l>::template expandA<k, l, 𝜅>(this->seed, A);
+  }
+
+  // Returns `t << 𝜈t`, in its NTT representation.
+  constexpr raccoon_poly_vec::poly_vec_t<k, 1> get_scaled_t_ntt() const
+  {
+    auto t = this->t << 𝜈t;
+    t.ntt();
+
+    return t;
+  }
+
   // Given a byte serialized Raccon signature and corresponding message (which was signed by the owner of the secret key, which is linked to this public key),
   // this routine verifies the validity of the signature, returning boolean truth value in case of success, else returning false. This is an implementation of
   // the algorithm 3 of the specification.
-  template<size_t l, size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  //
+  // Verification only handles public data, hence it can be asked to run in variable-time, by passing `raccoon_timing::variable_time_t` as `timing_t`, in
+  // which case it takes data dependent shortcuts, while its outcome stays the same.
+  template<size_t l, size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22, raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
   constexpr bool verify(std::span<const uint8_t> msg, std::span<const uint8_t, sig_byte_len> sig) const
   {
-    // Step 1: Attempt to decode signature into its components
-    auto sig_opt = raccoon_sig::sig_t<𝜅, k, l, 𝜈w, sig_byte_len>::from_bytes(sig);
-    const bool is_decoded = sig_opt.has_value();
-    if (!is_decoded) {
-      // Signature can't be deserialized back into its components
+    // Step 1, 2: Attempt to decode signature into its components and perform norms check, before paying for anything else
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
+    raccoon_poly_vec::poly_vec_t<k, 1> h{};
+    raccoon_poly_vec::poly_vec_t<l, 1> z{};
+
+    if (!decode_and_check<l, 𝜈w, sig_byte_len, Binf, B22, timing_t>(sig, c_hash, h, z)) {
       return false;
     }
 
-    auto sig_obj = sig_opt.value();
+    // Step 3: Bind public key with message
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    this->hash(𝜇);
+    raccoon_challenge::msg_hash<𝜅>(𝜇, msg, 𝜇);
+
+    // Step 4: Generate uniform matrix A
+    const auto A = this->template expand_A<l>();
+    const auto t = this->get_scaled_t_ntt();
+
+    return verify_with<l, 𝜈w, 𝜔, timing_t>(A, t, 𝜇, c_hash, h, z);
+  }
+
+  // Verifies a (message, signature) pair, same as `verify`, but as a pipeline of stages ( see `verify_stage_t` ), ordered by their cost, reporting the
+  // stage, which rejected the signature, and cycles spent in each stage. Unlike `verify`, signature of any byte length is accepted as input.
+  template<size_t l, size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22, raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
+  verify_report_t verify_staged(std::span<const uint8_t> msg, std::span<const uint8_t> sig) const
+  {
+    return verify_staged_with<l, 𝜈w, 𝜔, sig_byte_len, Binf, B22, timing_t>(
+      msg,
+      sig,
+      [this](std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> pk_digest) { this->hash(pk_digest); },
+      [this](const raccoon_poly_vec::poly_vec_t<l, 1>& z, const raccoon_poly::poly_t& c_poly) {
+        const auto A = this->template expand_A<l>();
+        const auto t = this->get_scaled_t_ntt();
+
+        return A * z - t * c_poly;
+      });
+  }
+
+  // Staged verification pipeline, behind `verify_staged`, given `digest(pk_digest)`, which computes digest of the public key, and `commit(z, c_poly)`,
+  // which computes `A * z - (t << 𝜈t) * c_poly`, in NTT representation, given both `z` and `c_poly` in their NTT representation.
+  template<size_t l,
+           size_t 𝜈w,
+           size_t 𝜔,
+           size_t sig_byte_len,
+           uint64_t Binf,
+           uint64_t B22,
+           raccoon_timing::timing_c timing_t,
+           typename digest_t,
+           typename commit_t>
+  static verify_report_t verify_staged_with(std::span<const uint8_t> msg, std::span<const uint8_t> sig, digest_t&& digest, commit_t&& commit)
+  {
+    verify_report_t report{};
+    uint64_t stage_begin = raccoon_cycles::now();
+
+    // Closes current stage, charging it with cycles spent since it began, and moves on to given stage
+    const auto advance = [&](const verify_stage_t next) {
+      const uint64_t stage_end = raccoon_cycles::now();
+
+      report.cycles[static_cast<size_t>(report.stage)] += stage_end - stage_begin;
+      report.stage = next;
+      stage_begin = stage_end;
+    };
+
+    if (sig.size() != sig_byte_len) {
+      advance(verify_stage_t::size);
+      return report;
+    }
+    advance(verify_stage_t::decode);
+
+    // Step 1: Decode signature, accumulating norms on the fly
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
+    raccoon_poly_vec::poly_vec_t<k, 1> h{};
+    raccoon_poly_vec::poly_vec_t<l, 1> z{};
+    raccoon_sig::sig_norms_t norms{};
+
+    const bool is_decoded = raccoon_sig::decode_with_norms<𝜅, k, l, 𝜈w, sig_byte_len, Binf, timing_t>(sig.first<sig_byte_len>(), c_hash, h, z, norms);
+    if (!is_decoded) {
+      // In variable-time mode, decoding stops early, on a coefficient which exceeds its infinity norm bound
+      const bool is_out_of_bounds = raccoon_timing::is_variable_time<timing_t> && !norms.template within_bounds<𝜈w, Binf, B22>();
+
+      advance(is_out_of_bounds ? verify_stage_t::norms : verify_stage_t::decode);
+      return report;
+    }
+    advance(verify_stage_t::norms);
 
     // Step 2: Perform norms check
-    const bool is_under_bounds = sig_obj.template check_bounds<Binf, B22>();
-    if (!is_under_bounds) {
-      // Signature is failing norms check
+    if (!norms.template within_bounds<𝜈w, Binf, B22>()) {
+      advance(verify_stage_t::norms);
+      return report;
+    }
+    advance(verify_stage_t::challenge);
+
+    // Step 3, 5: Bind public key with message and compute challenge polynomial
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    digest(𝜇);
+    raccoon_challenge::msg_hash<𝜅>(𝜇, msg, 𝜇);
+
+    auto c_poly = raccoon_poly::poly_t::chal_poly<𝜅, 𝜔, timing_t>(c_hash);
+    c_poly.ntt();
+    advance(verify_stage_t::commitment);
+
+    // Step 4, 6-9: Recompute commitment and check it against challenge hash
+    z.ntt();
+    auto y = commit(z, c_poly);
+    y.intt();
+
+    const bool is_verified = check_commitment<𝜈w, timing_t>(y, h, 𝜇, c_hash);
+    advance(is_verified ? verify_stage_t::accepted : verify_stage_t::commitment);
+
+    return report;
+  }
+
+  // Verifies a signature, given `2 * 𝜅` -bit digest 𝜇, binding the public key with the message, which was computed externally i.e. following algorithm
+  // 3 of the specification, skipping step 3. It's caller's responsibility to compute 𝜇, using this public key.
+  template<size_t l, size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22, raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
+  constexpr bool verify_digest(std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇,
+                               std::span<const uint8_t, sig_byte_len> sig) const
+  {
+    // Step 1, 2: Attempt to decode signature into its components and perform norms check
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
+    raccoon_poly_vec::poly_vec_t<k, 1> h{};
+    raccoon_poly_vec::poly_vec_t<l, 1> z{};
+
+    if (!decode_and_check<l, 𝜈w, sig_byte_len, Binf, B22, timing_t>(sig, c_hash, h, z)) {
       return false;
     }
 
-    std::array<uint8_t, raccoon_utils::get_pkey_byte_len<𝜅, k, raccoon_poly::N, 𝜈t>()> pk_bytes{};
-    this->to_bytes(pk_bytes);
+    // Step 4: Generate uniform matrix A
+    const auto A = this->template expand_A<l>();
+    const auto t = this->get_scaled_t_ntt();
+
+    return verify_with<l, 𝜈w, 𝜔, timing_t>(A, t, 𝜇, c_hash, h, z);
+  }
+
+  // Verifies a (message, signature) pair, same as `verify`, but keeps public matrix A in caller supplied workspace.
+  template<size_t l, size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  constexpr bool verify(std::span<const uint8_t> msg, std::span<const uint8_t, sig_byte_len> sig, raccoon_workspace::verify_workspace_t<k, l>& ws) const
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
+    raccoon_poly_vec::poly_vec_t<k, 1> h{};
+    raccoon_poly_vec::poly_vec_t<l, 1> z{};
+
+    if (!decode_and_check<l, 𝜈w, sig_byte_len, Binf, B22>(sig, c_hash, h, z)) {
+      return false;
+    }
+
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    this->hash(𝜇);
+    raccoon_challenge::msg_hash<𝜅>(𝜇, msg, 𝜇);
+
+    this->template expand_A<l>(ws.A);
+    const auto t = this->get_scaled_t_ntt();
+
+    return verify_with<l, 𝜈w, 𝜔>(ws.A, t, 𝜇, c_hash, h, z);
+  }
+
+  // Verifies a (message, signature) pair, same as `verify`, but given public matrix A, already expanded from seed of this public key and in its NTT
+  // representation, skipping step 4 of algorithm 3 of the specification. It's caller's responsibility to pass the matrix A, which was expanded from the
+  // same seed.
+  template<size_t l, size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  constexpr bool verify_using(const raccoon_poly_mat::poly_mat_t<k, l>& A, std::span<const uint8_t> msg, std::span<const uint8_t, sig_byte_len> sig) const
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
+    raccoon_poly_vec::poly_vec_t<k, 1> h{};
+    raccoon_poly_vec::poly_vec_t<l, 1> z{};
+
+    if (!decode_and_check<l, 𝜈w, sig_byte_len, Binf, B22>(sig, c_hash, h, z)) {
+      return false;
+    }
+
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    this->hash(𝜇);
+    raccoon_challenge::msg_hash<𝜅>(𝜇, msg, 𝜇);
+
+    const auto t = this->get_scaled_t_ntt();
+    return verify_with<l, 𝜈w, 𝜔>(A, t, 𝜇, c_hash, h, z);
+  }
+
+  // Verifies a (message, signature) pair, same as `verify`, but streams public matrix A, one row at a time, never materializing it. Each row of commitment
+  // vector `y = A * z - (t << 𝜈t) * c` is accumulated, one element of A at a time, then rounded, adjusted with hint and absorbed into challenge hash, before
+  // moving to the next row. Working set is hence a few polynomials, on top of decoded signature, instead of whole `k x l` matrix A and several `k` -rows
+  // vectors, which helps when running many concurrent verifications per core. Outcome of verification is same as that of `verify`.
+  template<size_t l, size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22, raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
+  constexpr bool verify_streaming(std::span<const uint8_t> msg, std::span<const uint8_t, sig_byte_len> sig) const
+  {
+    // Step 1, 2: Attempt to decode signature into its components and perform norms check
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
+    raccoon_poly_vec::poly_vec_t<k, 1> h{};
+    raccoon_poly_vec::poly_vec_t<l, 1> z{};
+
+    if (!decode_and_check<l, 𝜈w, sig_byte_len, Binf, B22, timing_t>(sig, c_hash, h, z)) {
+      return false;
+    }
 
     // Step 3: Bind public key with message
     std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
-    shake256::shake256_t hasher{};
+    this->hash(𝜇);
+    raccoon_challenge::msg_hash<𝜅>(𝜇, msg, 𝜇);
 
-    hasher.absorb(pk_bytes);
-    hasher.finalize();
-    hasher.squeeze(𝜇);
+    // Step 5: Compute challenge polynomial
+    z.ntt();
 
-    hasher.reset();
+    auto c_poly = raccoon_poly::poly_t::chal_poly<𝜅, 𝜔, timing_t>(c_hash);
+    c_poly.ntt();
 
-    hasher.absorb(𝜇);
-    hasher.absorb(msg);
-    hasher.finalize();
-    hasher.squeeze(𝜇);
+    // Step 4, 6-8: Recompute commitment and challenge hash, one row at a time
+    raccoon_challenge::chal_hasher_t<k, 𝜅> hasher{};
 
-    // Step 4: Generate uniform matrix A
-    const auto A = raccoon_poly_mat::poly_mat_t<k, l>::template expandA<k, l, 𝜅>(this->seed);
+    for (size_t ridx = 0; ridx < k; ridx++) {
+      auto y_row = raccoon_poly_mat::poly_mat_t<k, l>::template expandA_elem<𝜅>(this->seed, ridx, 0) * z[0][0];
+      for (size_t cidx = 1; cidx < l; cidx++) {
+        y_row += raccoon_poly_mat::poly_mat_t<k, l>::template expandA_elem<𝜅>(this->seed, ridx, cidx) * z[cidx][0];
+      }
+
+      auto t_row = this->t[ridx][0] << 𝜈t;
+      t_row.ntt();
+
+      y_row -= t_row * c_poly;
+      y_row.intt();
+
+      y_row.template rounding_shr<𝜈w>();
+      hasher.update(y_row.template add_mod<(field::Q >> 𝜈w)>(h[ridx][0]));
+    }
+
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash_prime{};
+    hasher.finalize(𝜇, c_hash_prime);
+
+    // Step 9: Check equality of commitment
+    return is_c_hash_equal<timing_t>(c_hash, c_hash_prime);
+  }
 
-    // Extract components of signature
-    auto c_hash = sig_obj.get_c_hash();
-    auto h = sig_obj.get_h();
-    auto z = sig_obj.get_z();
+  // Given a byte serialized signature, attempts to decode it straight into its components i.e. challenge hash, hint vector `h` and response vector `z`, both
+  // in their standard representation, and performs norms check on them, following step 1, 2 of algorithm 3 of the specification. Returns true, only if
+  // both of these steps pass.
+  template<size_t l, size_t 𝜈w, size_t sig_byte_len, uint64_t Binf, uint64_t B22, raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
+  static constexpr bool decode_and_check(std::span<const uint8_t, sig_byte_len> sig,
+                                         std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash,
+                                         raccoon_poly_vec::poly_vec_t<k, 1>& h,
+                                         raccoon_poly_vec::poly_vec_t<l, 1>& z)
+  {
+    return raccoon_sig::decode_and_check<𝜅, k, l, 𝜈w, sig_byte_len, Binf, B22, timing_t>(sig, c_hash, h, z);
+  }
+
+  // Given public matrix `A` and `t << 𝜈t`, both in their NTT representation, `2 * 𝜅` -bit digest 𝜇, binding public key with message, and components of a
+  // decoded signature, which has already passed norms check, this routine recomputes the commitment and checks it against the challenge hash, following
+  // steps 5-9 of algorithm 3 of the specification.
+  //
+  // Note, response vector `z` is transformed to its NTT representation, in place.
+  template<size_t l, size_t 𝜈w, size_t 𝜔, raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
+  static constexpr bool verify_with(const raccoon_poly_mat::poly_mat_t<k, l>& A,
+                                    const raccoon_poly_vec::poly_vec_t<k, 1>& t,
+                                    std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇,
+                                    std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash,
+                                    const raccoon_poly_vec::poly_vec_t<k, 1>& h,
+                                    raccoon_poly_vec::poly_vec_t<l, 1>& z)
+  {
     z.ntt();
 
     // Step 5: Compute challenge polynomial
-    auto c_poly = raccoon_poly::poly_t::chal_poly<𝜅, 𝜔>(c_hash);
+    auto c_poly = raccoon_poly::poly_t::chal_poly<𝜅, 𝜔, timing_t>(c_hash);
     c_poly.ntt();
 
-    auto t = this->t;
-    t = t << 𝜈t;
-    t.ntt();
-
     // Step 6: Recompute noisy LWE commitment vector y
     auto y = A * z - t * c_poly;
     y.intt();
 
+    return check_commitment<𝜈w, timing_t>(y, h, 𝜇, c_hash);
+  }
+
+  // Given recomputed noisy LWE commitment vector y, in its standard representation, hint vector h, `2 * 𝜅` -bit digest 𝜇 and challenge hash, carried by
+  // the signature, this routine checks whether the commitment matches, following steps 7-9 of algorithm 3 of the specification.
+  template<size_t 𝜈w, raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
+  static constexpr bool check_commitment(raccoon_poly_vec::poly_vec_t<k, 1>& y,
+                                         const raccoon_poly_vec::poly_vec_t<k, 1>& h,
+                                         std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇,
+                                         std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash)
+  {
     // Step 7: Adjust LWE commitment vector with hint vector, reduced small moduli `q >> 𝜈w`
     y.template rounding_shr<𝜈w>();
     auto w = y.template add_mod<(field::Q >> 𝜈w)>(h);
 
     // Step 8: Recompute challenge hash
-    std::array<uint8_t, c_hash.size()> c_hash_prime{};
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash_prime{};
     raccoon_challenge::chal_hash<k, 𝜅>(w, 𝜇, c_hash_prime);
 
-    using c_hash_t = std::span<const uint8_t, c_hash.size()>;
-
     // Step 9: Check equality of commitment
-    const auto is_equal = raccoon_utils::ct_eq_byte_array(c_hash_t(c_hash), c_hash_t(c_hash_prime));
+    return is_c_hash_equal<timing_t>(c_hash, c_hash_prime);
+  }
+
+  // Checks equality of given challenge hash and the recomputed one, following step 9 of algorithm 3 of the specification.
+  template<raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
+  static constexpr bool is_c_hash_equal(std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash,
+                                        std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash_prime)
+  {
+    if constexpr (raccoon_timing::is_variable_time<timing_t>) {
+      return std::ranges::equal(c_hash, c_hash_prime);
+    }
+
+    const auto is_equal = raccoon_utils::ct_eq_byte_array(c_hash, c_hash_prime);
     const auto is_verified = static_cast<bool>(is_equal >> (std::numeric_limits<decltype(is_equal)>::digits - 1));
 
     return is_verified;
@@ -143,4 +439,164 @@ public:
   }
 };
 
+// Raccoon Public Key, prepared for verifying many signatures, keeping public matrix `A`, `t << 𝜈t` (both in their NTT representation) and digest of the
+// public key resident, so that each verification call only pays for the signature dependent work.
+template<size_t 𝜅, size_t k, size_t l, size_t 𝜈t>
+struct prepared_pkey_t
+{
+public:
+  // Number of signatures, whose response vectors are multiplied with public matrix A at once, during batch verification.
+  static constexpr size_t BATCH_BLOCK_LEN = 8;
+
+private:
+  pkey_t<𝜅, k, 𝜈t> pkey{};
+  raccoon_poly_mat::poly_mat_t<k, l> A{};
+  raccoon_poly_vec::poly_vec_t<k, 1> t{};
+  std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> pk_digest{};
+
+  // Intermediates of batch verification, for one block of signatures, which passed decoding and norms check.
+  struct batch_block_t
+  {
+    std::array<size_t, BATCH_BLOCK_LEN> sig_idx{};
+    std::array<std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits>, BATCH_BLOCK_LEN> 𝜇{};
+    std::array<std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits>, BATCH_BLOCK_LEN> c_hash{};
+    std::array<raccoon_poly::poly_t, BATCH_BLOCK_LEN> c_poly{};
+    std::array<raccoon_poly_vec::poly_vec_t<k, 1>, BATCH_BLOCK_LEN> h{};
+    std::array<raccoon_poly_vec::poly_vec_t<l, 1>, BATCH_BLOCK_LEN> z{};
+    std::array<raccoon_poly_vec::poly_vec_t<k, 1>, BATCH_BLOCK_LEN> y{};
+  };
+
+public:
+  // Constructor(s)
+  constexpr prepared_pkey_t() = default;
+  explicit constexpr prepared_pkey_t(const pkey_t<𝜅, k, 𝜈t>& pkey)
+  {
+    this->pkey = pkey;
+    this->A = pkey.template expand_A<l>();
+    this->t = pkey.get_scaled_t_ntt();
+    pkey.hash(this->pk_digest);
+  }
+
+  // Accessor(s)
+  constexpr const pkey_t<𝜅, k, 𝜈t>& get_pkey() const { return this->pkey; }
+  constexpr const raccoon_poly_mat::poly_mat_t<k, l>& get_A() const { return this->A; }
+  constexpr const raccoon_poly_vec::poly_vec_t<k, 1>& get_t() const { return this->t; }
+  constexpr std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> get_pk_digest() const { return this->pk_digest; }
+
+  // Verifies a (message, signature) pair, returning boolean truth value in case of success, which is same as `pkey_t::verify`, minus the key dependent setup.
+  template<size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22, raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
+  constexpr bool verify(std::span<const uint8_t> msg, std::span<const uint8_t, sig_byte_len> sig) const
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
+    raccoon_poly_vec::poly_vec_t<k, 1> h{};
+    raccoon_poly_vec::poly_vec_t<l, 1> z{};
+
+    // Malformed signatures get rejected before the message is hashed
+    if (!pkey_t<𝜅, k, 𝜈t>::template decode_and_check<l, 𝜈w, sig_byte_len, Binf, B22, timing_t>(sig, c_hash, h, z)) {
+      return false;
+    }
+
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    raccoon_challenge::msg_hash<𝜅>(this->pk_digest, msg, 𝜇);
+
+    return pkey_t<𝜅, k, 𝜈t>::template verify_with<l, 𝜈w, 𝜔, timing_t>(this->A, this->t, 𝜇, c_hash, h, z);
+  }
+
+  // Verifies a (message, signature) pair, same as `pkey_t::verify_staged`, reporting the stage, which rejected the signature, and cycles spent in each stage.
+  template<size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22, raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
+  verify_report_t verify_staged(std::span<const uint8_t> msg, std::span<const uint8_t> sig) const
+  {
+    return pkey_t<𝜅, k, 𝜈t>::template verify_staged_with<l, 𝜈w, 𝜔, sig_byte_len, Binf, B22, timing_t>(
+      msg,
+      sig,
+      [this](std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> pk_digest) {
+        std::copy(this->pk_digest.begin(), this->pk_digest.end(), pk_digest.begin());
+      },
+      [this](const raccoon_poly_vec::poly_vec_t<l, 1>& z, const raccoon_poly::poly_t& c_poly) { return this->A * z - this->t * c_poly; });
+  }
+
+  // Verifies a signature, given `2 * 𝜅` -bit digest 𝜇, binding the public key with the message, which was already computed by the caller.
+  template<size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22, raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
+  constexpr bool verify_digest(std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇,
+                               std::span<const uint8_t, sig_byte_len> sig) const
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
+    raccoon_poly_vec::poly_vec_t<k, 1> h{};
+    raccoon_poly_vec::poly_vec_t<l, 1> z{};
+
+    if (!pkey_t<𝜅, k, 𝜈t>::template decode_and_check<l, 𝜈w, sig_byte_len, Binf, B22, timing_t>(sig, c_hash, h, z)) {
+      return false;
+    }
+
+    return pkey_t<𝜅, k, 𝜈t>::template verify_with<l, 𝜈w, 𝜔, timing_t>(this->A, this->t, 𝜇, c_hash, h, z);
+  }
+
+  // Given a batch of messages and their signatures s.t. i-th signature is `sigs_bytes[i * sig_byte_len, (i + 1) * sig_byte_len)`, verifies each of them,
+  // writing outcome of i-th verification to `results[i]`. Returns true, only if all of them are valid. Throws `std::invalid_argument`, if `sigs_bytes` or
+  // `results` don't hold exactly `msgs.size()` entries.
+  //
+  // Signatures are verified in blocks of `BATCH_BLOCK_LEN`, s.t. response vectors of a block, which pass decoding and norms check, are stacked and
+  // multiplied with public matrix A at once, loading each polynomial of A once per block, instead of once per signature. Remaining work of the block i.e.
+  // inverse NTTs and challenge hashes are also done back-to-back, as separate phases. Outcome of each verification is same as that of `verify`.
+  template<size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  bool verify_batch(std::span<const std::span<const uint8_t>> msgs, std::span<const uint8_t> sigs_bytes, std::span<bool> results) const
+  {
+    if (sigs_bytes.size() != msgs.size() * sig_byte_len) {
+      throw std::invalid_argument("signature buffer must hold exactly one signature per message");
+    }
+    if (results.size() != msgs.size()) {
+      throw std::invalid_argument("result buffer must hold exactly one entry per message");
+    }
+
+    auto block = std::make_unique<batch_block_t>();
+    bool all_verified = true;
+
+    for (size_t from = 0; from < msgs.size(); from += BATCH_BLOCK_LEN) {
+      const size_t to = std::min(from + BATCH_BLOCK_LEN, msgs.size());
+      size_t count = 0;
+
+      // Step 1-3, 5: Decode signature, perform norms check, bind public key with message and compute challenge polynomial, for each signature of the block
+      for (size_t sig_idx = from; sig_idx < to; sig_idx++) {
+        results[sig_idx] = false;
+
+        const size_t slot = count;
+        const auto sig = sigs_bytes.subspan(sig_idx * sig_byte_len).template first<sig_byte_len>();
+
+        if (!pkey_t<𝜅, k, 𝜈t>::template decode_and_check<l, 𝜈w, sig_byte_len, Binf, B22>(sig, block->c_hash[slot], block->h[slot], block->z[slot])) {
+          all_verified = false;
+          continue;
+        }
+
+        count++;
+        block->sig_idx[slot] = sig_idx;
+        block->z[slot].ntt();
+
+        block->c_poly[slot] = raccoon_poly::poly_t::chal_poly<𝜅, 𝜔>(block->c_hash[slot]);
+        block->c_poly[slot].ntt();
+
+        raccoon_challenge::msg_hash<𝜅>(this->pk_digest, msgs[sig_idx], block->𝜇[slot]);
+      }
+
+      // Step 6: Recompute noisy LWE commitment vectors y, for the whole block at once
+      this->A.multiply_batch(block->z, block->y, count);
+      for (size_t slot = 0; slot < count; slot++) {
+        block->y[slot] = block->y[slot] - this->t * block->c_poly[slot];
+      }
+      for (size_t slot = 0; slot < count; slot++) {
+        block->y[slot].intt();
+      }
+
+      // Step 7-9: Recompute challenge hashes and check equality of commitments
+      for (size_t slot = 0; slot < count; slot++) {
+        const bool is_verified = pkey_t<𝜅, k, 𝜈t>::template check_commitment<𝜈w>(block->y[slot], block->h[slot], block->𝜇[slot], block->c_hash[slot]);
+
+        results[block->sig_idx[slot]] = is_verified;
+        all_verified &= is_verified;
+      }
+    }
+
+    return all_verified;
+  }
+};
+
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include "presignature.hpp"
 #include "public_key.hpp"
 #include "raccoon/internals/polynomial/challenge.hpp"
 #include "raccoon/internals/polynomial/poly.hpp"
@@ -6,8 +7,21 @@
 #include "raccoon/internals/rng/mrng.hpp"
 #include "raccoon/internals/rng/prng.hpp"
 #include "raccoon/internals/utility/params.hpp"
+#include "raccoon/internals/utility/sign_policy.hpp"
 #include "raccoon/internals/utility/utils.hpp"
+#include "raccoon/internals/workspace.hpp"
 #include "signature.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <vector>
 
 namespace raccoon_skey {
 
@@ -63,36 +77,55 @@ public:
   static constexpr skey_t generate(std::span<const uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits> seed)
     requires(raccoon_params::validate_keygen_args(𝜅, k, l, d, 𝑢t, 𝜈t, rep))
   {
-    prng::prng_t prng{};
-    mrng::mrng_t<d> mrng{};
+    const auto ws = raccoon_workspace::make_secure<raccoon_workspace::keygen_workspace_t<k, l, d>>();
+    return generate<𝑢t, rep>(seed, *ws);
+  }
 
+  // Same as above, but keeps all large intermediates in caller supplied workspace.
+  template<size_t 𝑢t, size_t rep>
+  static constexpr skey_t generate(std::span<const uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits> seed,
+                                   raccoon_workspace::keygen_workspace_t<k, l, d>& ws)
+    requires(raccoon_params::validate_keygen_args(𝜅, k, l, d, 𝑢t, 𝜈t, rep))
+  {
     // Step 2: Generate matrix A
-    const auto A = raccoon_poly_mat::poly_mat_t<k, l>::template expandA<k, l, 𝜅>(seed);
+    raccoon_poly_mat::poly_mat_t<k, l>::template expandA<k, l, 𝜅>(seed, ws.A);
+
+    return generate_with<𝑢t, rep>(seed, ws.A, ws);
+  }
+
+  // Same as above, but given public matrix A, already expanded from seed and in its NTT representation, skipping step 2 of algorithm 1 of the
+  // specification. It's caller's responsibility to pass the matrix A, which was expanded from the same seed. Matrix A, held in workspace, isn't touched.
+  template<size_t 𝑢t, size_t rep>
+  static constexpr skey_t generate_with(std::span<const uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits> seed,
+                                        const raccoon_poly_mat::poly_mat_t<k, l>& A,
+                                        raccoon_workspace::keygen_workspace_t<k, l, d>& ws)
+    requires(raccoon_params::validate_keygen_args(𝜅, k, l, d, 𝑢t, 𝜈t, rep))
+  {
+    prng::prng_t prng{};
+    mrng::mrng_t<d> mrng{};
 
     // Step 3: Generate masked zero vector [[s]]
-    auto s = raccoon_poly_vec::poly_vec_t<l, d>::zero_encoding(mrng);
+    ws.s.fill_zero_encoding(mrng);
 
     // Step 4: Generate secret distribution [[s]]
-    s.template add_rep_noise<𝑢t, rep, 𝜅>(prng, mrng);
+    ws.s.template add_rep_noise<𝑢t, rep, 𝜅>(prng, mrng);
 
     // Step 5: Compute matrix vector multiplication, producing masked vector [[t]]
-    s.ntt();
-    auto t = A * s;
-    t.intt();
+    ws.s.ntt();
+    A.multiply(ws.s, ws.t);
+    ws.t.intt();
 
     // Step 6: Add masked noise to vector [[t]]
-    t.template add_rep_noise<𝑢t, rep, 𝜅>(prng, mrng);
+    ws.t.template add_rep_noise<𝑢t, rep, 𝜅>(prng, mrng);
 
     // Step 7: Collapse [[t]] into unmasked format
-    auto t_prime = t.decode();
+    auto t_prime = ws.t.decode();
 
     // Step 8: Rounding and right shifting of unmasked vector t
     t_prime.template rounding_shr<𝜈t>();
 
     const auto vk = raccoon_pkey::pkey_t<𝜅, k, 𝜈t>(seed, t_prime);
-    const auto sk = raccoon_skey::skey_t<𝜅, k, l, d, 𝜈t>(vk, s);
-
-    return sk;
+    return raccoon_skey::skey_t<𝜅, k, l, d, 𝜈t>(vk, ws.s);
   }
 
   // This routine can be used for signing a message of arbitrary length, following algorithm 2 of the specification.
@@ -101,110 +134,352 @@ public:
   template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
   constexpr void sign(std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes) const
     requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    // Step 2: Bind public key with message
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    this->pkey.hash(𝜇);
+    raccoon_challenge::msg_hash<𝜅>(𝜇, msg, 𝜇);
+
+    this->template sign_digest<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(𝜇, sig_bytes);
+  }
+
+  // Signs, given `2 * 𝜅` -bit digest 𝜇, binding the public key with the message, which was computed externally i.e. following algorithm 2 of the
+  // specification, skipping step 2. It's caller's responsibility to compute 𝜇, using the same public key, as the one in this secret key.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  constexpr void sign_digest(std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇, std::span<uint8_t, sig_byte_len> sig_bytes) const
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
   {
     auto s = this->s;
-    auto t = this->pkey.get_t();
+    const auto t = this->pkey.get_scaled_t_ntt();
 
-    t = t << 𝜈t;
-    t.ntt();
+    // Step 3: Generate matrix A
+    const auto A = this->pkey.template expand_A<l>();
 
-    std::array<uint8_t, raccoon_utils::get_pkey_byte_len<𝜅, k, raccoon_poly::N, 𝜈t>()> pk_bytes{};
-    this->pkey.to_bytes(pk_bytes);
+    sign_with<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(A, t, s, 𝜇, sig_bytes);
+  }
 
-    // Step 2: Bind public key with message
+  // Signs a message of arbitrary length, same as `sign`, but given public matrix A, already expanded from seed of the public key and in its NTT
+  // representation, skipping step 3 of algorithm 2 of the specification. It's caller's responsibility to pass the matrix A, which was expanded from the
+  // same seed.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  constexpr void sign_using(const raccoon_poly_mat::poly_mat_t<k, l>& A, std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes) const
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
     std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    this->pkey.hash(𝜇);
+    raccoon_challenge::msg_hash<𝜅>(𝜇, msg, 𝜇);
 
-    shake256::shake256_t hasher{};
-    hasher.absorb(pk_bytes);
-    hasher.finalize();
-    hasher.squeeze(𝜇);
+    auto s = this->s;
+    const auto t = this->pkey.get_scaled_t_ntt();
 
-    hasher.reset();
+    sign_with<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(A, t, s, 𝜇, sig_bytes);
+  }
 
-    hasher.absorb(𝜇);
-    hasher.absorb(msg);
-    hasher.finalize();
-    hasher.squeeze(𝜇);
+  // Signs a message of arbitrary length, same as `sign`, but keeps all large intermediates, whose size grows with number of shares, in caller supplied
+  // workspace. Temporaries of size independent of the number of shares still live on stack.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  constexpr void sign(std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes, raccoon_workspace::sign_workspace_t<k, l, d>& ws) const
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    this->pkey.hash(𝜇);
+    raccoon_challenge::msg_hash<𝜅>(𝜇, msg, 𝜇);
 
-    // Step 3: Generate matrix A
-    const auto A = raccoon_poly_mat::poly_mat_t<k, l>::template expandA<k, l, 𝜅>(this->pkey.get_seed());
+    const auto t = this->pkey.get_scaled_t_ntt();
+    this->pkey.template expand_A<l>(ws.A);
+    ws.s = this->s;
+
+    sign_with<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(ws.A, t, ws.s, 𝜇, sig_bytes, ws.attempt);
+  }
+
+  // Signs a message of arbitrary length, same as `sign`, except that shares of the masked secret key vector `[[s]]`, held by this object, are refreshed in
+  // place, instead of copying them first. Not safe to call concurrently on the same secret key.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  constexpr void sign_in_place(std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes)
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    this->pkey.hash(𝜇);
+    raccoon_challenge::msg_hash<𝜅>(𝜇, msg, 𝜇);
+
+    const auto t = this->pkey.get_scaled_t_ntt();
+    const auto A = this->pkey.template expand_A<l>();
+
+    sign_with<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(A, t, this->s, 𝜇, sig_bytes);
+  }
 
+  // Signs a message of arbitrary length, same as above, while running speculative signing attempts in parallel, as dictated by the policy.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  void sign(std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes, const raccoon_sign_policy::speculative_t& policy) const
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    const auto t = this->pkey.get_scaled_t_ntt();
+
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    this->pkey.hash(𝜇);
+    raccoon_challenge::msg_hash<𝜅>(𝜇, msg, 𝜇);
+
+    const auto A = this->pkey.template expand_A<l>();
+
+    sign_with<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(A, t, this->s, 𝜇, sig_bytes, policy);
+  }
+
+  // Given public matrix `A` and `t << 𝜈t`, both in their NTT representation, masked secret key vector `[[s]]` and `2 * 𝜅` -bit digest 𝜇, binding public key
+  // with message, this routine produces a byte serialized signature, following steps 4-20 of algorithm 2 of the specification.
+  //
+  // Note, `[[s]]` is refreshed in place, in each signing attempt, so pass a copy, if shares of the secret key must be left untouched.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  static constexpr void sign_with(const raccoon_poly_mat::poly_mat_t<k, l>& A,
+                                  const raccoon_poly_vec::poly_vec_t<k, 1>& t,
+                                  raccoon_poly_vec::poly_vec_t<l, d>& s,
+                                  std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇,
+                                  std::span<uint8_t, sig_byte_len> sig_bytes)
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    // Masked intermediates are too large for the stack, with many shares, and they are wiped when released
+    const auto ws = raccoon_workspace::make_secure<raccoon_workspace::attempt_workspace_t<k, l, d>>();
+    sign_with<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(A, t, s, 𝜇, sig_bytes, *ws);
+  }
+
+  // Same as above, but keeps intermediates of signing attempts in caller supplied workspace.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  static constexpr void sign_with(const raccoon_poly_mat::poly_mat_t<k, l>& A,
+                                  const raccoon_poly_vec::poly_vec_t<k, 1>& t,
+                                  raccoon_poly_vec::poly_vec_t<l, d>& s,
+                                  std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇,
+                                  std::span<uint8_t, sig_byte_len> sig_bytes,
+                                  raccoon_workspace::attempt_workspace_t<k, l, d>& ws)
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
     prng::prng_t prng{};
     mrng::mrng_t<d> mrng{};
 
     while (true) {
-      // Step 4: Generate masked zero vector [[r]]
-      auto r = raccoon_poly_vec::poly_vec_t<l, d>::zero_encoding(mrng);
+      // Step 4-9: Compute message independent commitment
+      commit<𝑢w, 𝜈w, rep>(A, ws.r, ws.w, ws.w_prime, prng, mrng);
 
-      // Step 5: Add masked noise to [[r]]
-      r.template add_rep_noise<𝑢w, rep, 𝜅>(prng, mrng);
+      // Step 10-20: Compute response, attempting to serialize signature
+      const bool is_signed = respond<𝜈w, 𝜔, sig_byte_len, Binf, B22>(A, t, s, 𝜇, ws.r, ws.w_prime, mrng, sig_bytes);
+      if (!is_signed) {
+        // Signature can't be serialized or it fails norms check, let's retry
+        continue;
+      }
+
+      // Just signed the message successfully !
+      break;
+    }
+  }
 
-      // Step 6: Compute matrix vector multiplication, producing masked vector [[w]]
-      r.ntt();
-      auto w = A * r;
-      w.intt();
+  // Given public matrix `A` and `t << 𝜈t`, both in their NTT representation, masked secret key vector `[[s]]` and `2 * 𝜅` -bit digest 𝜇, this routine
+  // runs `policy.num_attempts` -many independent signing attempts in parallel, s.t. one runs on the calling thread and others on the thread pool. Each
+  // attempt works on its own copy of `[[s]]`, with its own randomness, and writes to its own signature buffer. First attempt to succeed publishes its
+  // signature and requests others to stop, which they check for between commitment and response computation. Returns only after all attempts return.
+  // Intermediates of every attempt, including losing ones, are wiped before being released.
+  //
+  // If an attempt throws, others are still waited for. Exception is rethrown to the caller, only if no attempt has published a signature. When called
+  // from a worker thread of `policy.pool` itself, all attempts run on the calling thread, one after another, as waiting on the same pool could deadlock.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  static void sign_with(const raccoon_poly_mat::poly_mat_t<k, l>& A,
+                        const raccoon_poly_vec::poly_vec_t<k, 1>& t,
+                        const raccoon_poly_vec::poly_vec_t<l, d>& s,
+                        std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇,
+                        std::span<uint8_t, sig_byte_len> sig_bytes,
+                        const raccoon_sign_policy::speculative_t& policy)
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    if (policy.pool.is_worker_thread()) {
+      auto s_copy = raccoon_workspace::make_secure<raccoon_poly_vec::poly_vec_t<l, d>>(s);
+      auto ws = raccoon_workspace::make_secure<raccoon_workspace::attempt_workspace_t<k, l, d>>();
 
-      // Step 7: Add masked noise to vector [[w]]
-      w.template add_rep_noise<𝑢w, rep, 𝜅>(prng, mrng);
+      sign_with<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(A, t, *s_copy, 𝜇, sig_bytes, *ws);
+      return;
+    }
 
-      // Step 8: Collapse [[w]] into unmasked format
-      auto w_prime = w.decode();
+    const size_t num_attempts = std::max<size_t>(policy.num_attempts, 1);
 
-      // Step 9: Rounding and right shifting of unmasked vector w
-      w_prime.template rounding_shr<𝜈w>();
+    std::stop_source stop{};
+    std::latch finished(static_cast<std::ptrdiff_t>(num_attempts - 1));
 
-      // Step 10: Compute challenge hash
-      std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
-      raccoon_challenge::chal_hash<k, 𝜅>(w_prime, 𝜇, c_hash);
+    bool is_published = false;
+    std::mutex error_lock{};
+    std::exception_ptr error{};
 
-      // Step 11: Compute challenge polynomial
-      auto c_poly = raccoon_poly::poly_t::chal_poly<𝜅, 𝜔>(c_hash);
-      c_poly.ntt();
+    const auto attempt = [&](std::stop_token stoken) {
+      if (stoken.stop_requested()) {
+        return;
+      }
 
-      // Step 12: Refresh masked secret key vector [[s]]
-      s.refresh(mrng);
+      // Large intermediates, including masked commitment vector `[[w]]`, live on heap, so that pool worker threads don't need bigger stacks than the
+      // calling thread. They are wiped, when released.
+      auto s_copy = raccoon_workspace::make_secure<raccoon_poly_vec::poly_vec_t<l, d>>(s);
+      auto ws = raccoon_workspace::make_secure<raccoon_workspace::attempt_workspace_t<k, l, d>>();
+      auto attempt_sig = raccoon_workspace::make_secure<std::array<uint8_t, sig_byte_len>>();
 
-      // Step 13: Refresh masked vector [[r]]
-      r.refresh(mrng);
+      prng::prng_t prng{};
+      mrng::mrng_t<d> mrng{};
 
-      // Step 14: Compute masked response vector [[z]]
-      auto z = s * c_poly + r;
+      while (!stoken.stop_requested()) {
+        commit<𝑢w, 𝜈w, rep>(A, ws->r, ws->w, ws->w_prime, prng, mrng);
+        if (stoken.stop_requested()) {
+          break;
+        }
 
-      // Step 15: Refresh masked response vector [[z]], before collapsing it
-      z.refresh(mrng);
+        const bool is_signed = respond<𝜈w, 𝜔, sig_byte_len, Binf, B22>(A, t, *s_copy, 𝜇, ws->r, ws->w_prime, mrng, *attempt_sig);
+        if (is_signed) {
+          // Only the first successful attempt gets to publish its signature
+          if (stop.request_stop()) {
+            std::copy(attempt_sig->begin(), attempt_sig->end(), sig_bytes.begin());
+            is_published = true;
+          }
+          break;
+        }
+      }
+    };
 
-      // Step 16: Collapse [[z]] into unmasked format
-      auto z_prime = z.decode();
+    // Runs an attempt, keeping the first exception thrown by any of them. Returns false, if it threw.
+    const auto guarded_attempt = [&] {
+      try {
+        attempt(stop.get_token());
+        return true;
+      } catch (...) {
+        std::scoped_lock guard(error_lock);
+        if (!error) {
+          error = std::current_exception();
+        }
+        return false;
+      }
+    };
 
-      // Step 17: Compute noisy LWE commitment vector y
-      auto y = A * z_prime - t * c_poly;
-      y.intt();
-      z_prime.intt();
+    size_t num_submitted = 0;
+    try {
+      for (; num_submitted < num_attempts - 1; num_submitted++) {
+        policy.pool.submit([&] {
+          raccoon_thread_pool::count_down_guard_t guard{ finished };
+          guarded_attempt();
+        });
+      }
+    } catch (...) {
+      // Attempts, which couldn't be submitted, are never going to count down, hence they're accounted for here
+      finished.count_down(static_cast<std::ptrdiff_t>(num_attempts - 1 - num_submitted));
+      stop.request_stop();
+      finished.wait();
 
-      // Step 18: Computes hint vector h, subtraction modulo `q >> 𝜈w`
-      y.template rounding_shr<𝜈w>();
-      auto h = w_prime.template sub_mod<(field::Q >> 𝜈w)>(y);
+      throw;
+    }
 
-      // Step 19: Convert signature components into serialization friendly format
-      auto sig = raccoon_sig::sig_t<𝜅, k, l, 𝜈w, sig_byte_len>(c_hash, h, z_prime);
+    if (!guarded_attempt()) {
+      // Calling thread's attempt failed, let's not keep others running for nothing
+      stop.request_stop();
+    }
+    finished.wait();
 
-      // Step 19: Attempt to serialize signature, given fixed space
-      const bool is_encoded = sig.to_bytes(sig_bytes);
-      if (!is_encoded) {
-        // Signature can't be serialized within given fixed space, let's retry
-        continue;
-      }
+    // All attempts have returned, hence they no longer touch `is_published` or `error`
+    if (!is_published && error) {
+      std::rethrow_exception(error);
+    }
+  }
 
-      // Step 20: If serialization of signature passes, do a final round of sanity check on *raw* signature
-      const bool is_under_bounds = sig.template check_bounds<Binf, B22>();
-      if (!is_under_bounds) {
-        // Signature is failing norms check, let's retry
-        continue;
-      }
+  // Given public matrix `A` in its NTT representation, this routine computes message independent commitment, following steps 4-9 of algorithm 2 of the
+  // specification, producing masked vector `[[r]]`, in its NTT representation, and rounded, unmasked commitment vector `w'`.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep>
+  static constexpr void commit(const raccoon_poly_mat::poly_mat_t<k, l>& A,
+                               raccoon_poly_vec::poly_vec_t<l, d>& r,
+                               raccoon_poly_vec::poly_vec_t<k, 1>& w_prime,
+                               prng::prng_t& prng,
+                               mrng::mrng_t<d>& mrng)
+  {
+    raccoon_poly_vec::poly_vec_t<k, d> w{};
+    commit<𝑢w, 𝜈w, rep>(A, r, w, w_prime, prng, mrng);
+  }
 
-      // Just signed the message successfully !
-      break;
+  // Same as above, but uses caller supplied masked vector `[[w]]` as scratch space.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep>
+  static constexpr void commit(const raccoon_poly_mat::poly_mat_t<k, l>& A,
+                               raccoon_poly_vec::poly_vec_t<l, d>& r,
+                               raccoon_poly_vec::poly_vec_t<k, d>& w,
+                               raccoon_poly_vec::poly_vec_t<k, 1>& w_prime,
+                               prng::prng_t& prng,
+                               mrng::mrng_t<d>& mrng)
+  {
+    // Step 4: Generate masked zero vector [[r]]
+    r.fill_zero_encoding(mrng);
+
+    // Step 5: Add masked noise to [[r]]
+    r.template add_rep_noise<𝑢w, rep, 𝜅>(prng, mrng);
+
+    // Step 6: Compute matrix vector multiplication, producing masked vector [[w]]
+    r.ntt();
+    A.multiply(r, w);
+    w.intt();
+
+    // Step 7: Add masked noise to vector [[w]]
+    w.template add_rep_noise<𝑢w, rep, 𝜅>(prng, mrng);
+
+    // Step 8: Collapse [[w]] into unmasked format
+    w_prime = w.decode();
+
+    // Step 9: Rounding and right shifting of unmasked vector w
+    w_prime.template rounding_shr<𝜈w>();
+  }
+
+  // Given public matrix `A` and `t << 𝜈t`, both in their NTT representation, masked secret key vector `[[s]]`, `2 * 𝜅` -bit digest 𝜇 and a commitment
+  // `([[r]], w')`, computed using `commit`, this routine computes response, following steps 10-20 of algorithm 2 of the specification, attempting to
+  // serialize the signature. Returns true, only if signature can be serialized within `sig_byte_len` -bytes and it passes norms check.
+  //
+  // Note, both `[[s]]` and `[[r]]` are refreshed in place. A commitment must never be used more than once, irrespective of the outcome.
+  template<size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  static constexpr bool respond(const raccoon_poly_mat::poly_mat_t<k, l>& A,
+                                const raccoon_poly_vec::poly_vec_t<k, 1>& t,
+                                raccoon_poly_vec::poly_vec_t<l, d>& s,
+                                std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇,
+                                raccoon_poly_vec::poly_vec_t<l, d>& r,
+                                const raccoon_poly_vec::poly_vec_t<k, 1>& w_prime,
+                                mrng::mrng_t<d>& mrng,
+                                std::span<uint8_t, sig_byte_len> sig_bytes)
+  {
+    // Step 10: Compute challenge hash
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
+    raccoon_challenge::chal_hash<k, 𝜅>(w_prime, 𝜇, c_hash);
+
+    // Step 11: Compute challenge polynomial
+    auto c_poly = raccoon_poly::poly_t::chal_poly<𝜅, 𝜔>(c_hash);
+    c_poly.ntt();
+
+    // Step 12: Refresh masked secret key vector [[s]]
+    s.refresh(mrng);
+
+    // Step 13: Refresh masked vector [[r]]
+    r.refresh(mrng);
+
+    // Step 14: Compute masked response vector [[z]], in place of [[r]], which is never used again
+    r.add_scaled(s, c_poly);
+    auto& z = r;
+
+    // Step 15: Refresh masked response vector [[z]], before collapsing it
+    z.refresh(mrng);
+
+    // Step 16: Collapse [[z]] into unmasked format
+    auto z_prime = z.decode();
+
+    // Step 17: Compute noisy LWE commitment vector y
+    auto y = A * z_prime - t * c_poly;
+    y.intt();
+    z_prime.intt();
+
+    // Step 18: Computes hint vector h, subtraction modulo `q >> 𝜈w`
+    y.template rounding_shr<𝜈w>();
+    auto h = w_prime.template sub_mod<(field::Q >> 𝜈w)>(y);
+
+    // Step 19, 20: Before serializing anything, check whether signature can be serialized within given fixed space and whether it passes norms check
+    const auto outcome = raccoon_sig::precheck<𝜅, k, l, 𝜈w, sig_byte_len, Binf, B22>(h, z_prime);
+    raccoon_sig::rejection_counters.record(outcome);
+    if (outcome != raccoon_sig::precheck_t::ok) {
+      return false;
     }
+
+    // Step 19: Convert signature components into serialization friendly format and serialize, which must succeed, as it passed the pre-check
+    auto sig = raccoon_sig::sig_t<𝜅, k, l, 𝜈w, sig_byte_len>(c_hash, h, z_prime);
+    return sig.to_bytes(sig_bytes);
   }
 
   // Byte serializes the secret key, which includes a copy of the public key.
@@ -236,4 +511,613 @@ public:
   }
 };
 
+// Raccoon Secret Key, prepared for signing many messages, keeping public matrix `A`, `t << 𝜈t` (both in their NTT representation) and digest of the public
+// key resident, so that each signing call only pays for the message dependent work.
+template<size_t 𝜅, size_t k, size_t l, size_t d, size_t 𝜈t>
+struct prepared_skey_t
+{
+private:
+  skey_t<𝜅, k, l, d, 𝜈t> skey{};
+  raccoon_poly_mat::poly_mat_t<k, l> A{};
+  raccoon_poly_vec::poly_vec_t<k, 1> t{};
+  std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> pk_digest{};
+
+  // Checks that given presignature was computed under this key, as its commitment is of no use under any other key. Digest of the public key is public,
+  // hence it's compared in variable-time. Throws `std::invalid_argument`, if it wasn't.
+  void check_presig(const raccoon_presig::presig_t<𝜅, k, l, d>& presig) const
+  {
+    if (!std::ranges::equal(presig.pk_digest, this->pk_digest)) {
+      throw std::invalid_argument("presignature was computed under another key");
+    }
+  }
+
+public:
+  // Constructor(s)
+  constexpr prepared_skey_t() = default;
+  explicit constexpr prepared_skey_t(const skey_t<𝜅, k, l, d, 𝜈t>& skey)
+  {
+    this->skey = skey;
+    this->A = skey.get_pkey().template expand_A<l>();
+    this->t = skey.get_pkey().get_scaled_t_ntt();
+    skey.get_pkey().hash(this->pk_digest);
+  }
+
+  // Accessor(s)
+  constexpr const skey_t<𝜅, k, l, d, 𝜈t>& get_skey() const { return this->skey; }
+  constexpr const raccoon_poly_mat::poly_mat_t<k, l>& get_A() const { return this->A; }
+  constexpr const raccoon_poly_vec::poly_vec_t<k, 1>& get_t() const { return this->t; }
+  constexpr std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> get_pk_digest() const { return this->pk_digest; }
+
+  // Refresh the shares of masked secret key polynomial vector `[[s]]`
+  constexpr void refresh() { this->skey.refresh(); }
+
+  // Signs a message of arbitrary length, producing a byte serialized signature, which is same as `skey_t::sign`, minus the key dependent setup.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  constexpr void sign(std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes) const
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    auto s = this->skey.get_s();
+
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    raccoon_challenge::msg_hash<𝜅>(this->pk_digest, msg, 𝜇);
+
+    skey_t<𝜅, k, l, d, 𝜈t>::template sign_with<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(this->A, this->t, s, 𝜇, sig_bytes);
+  }
+
+  // Signs a message of arbitrary length, same as `sign`, except that shares of the masked secret key vector `[[s]]`, held by this object, are refreshed in
+  // place, instead of copying them first. Not safe to call concurrently on the same prepared secret key, see `pooled_skey_t` for that.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  constexpr void sign_in_place(std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes)
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    raccoon_challenge::msg_hash<𝜅>(this->pk_digest, msg, 𝜇);
+
+    skey_t<𝜅, k, l, d, 𝜈t>::template sign_with<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(this->A, this->t, this->skey.get_s(), 𝜇, sig_bytes);
+  }
+
+  // Signs a message of arbitrary length, same as `sign`, but keeps copy of `[[s]]` and intermediates of signing attempts in caller supplied workspace. Public
+  // matrix A of the workspace is left untouched, as it's already resident in the prepared secret key.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  constexpr void sign(std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes, raccoon_workspace::sign_workspace_t<k, l, d>& ws) const
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    raccoon_challenge::msg_hash<𝜅>(this->pk_digest, msg, 𝜇);
+
+    ws.s = this->skey.get_s();
+    skey_t<𝜅, k, l, d, 𝜈t>::template sign_with<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(this->A, this->t, ws.s, 𝜇, sig_bytes, ws.attempt);
+  }
+
+  // Signs a message of arbitrary length, running speculative signing attempts in parallel, as dictated by the policy.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  void sign(std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes, const raccoon_sign_policy::speculative_t& policy) const
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    raccoon_challenge::msg_hash<𝜅>(this->pk_digest, msg, 𝜇);
+
+    skey_t<𝜅, k, l, d, 𝜈t>::template sign_with<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(this->A, this->t, this->skey.get_s(), 𝜇, sig_bytes, policy);
+  }
+
+  // Signs a batch of messages, each of arbitrary length, producing byte serialized signatures, s.t. i-th signature is written to
+  // `sigs_bytes[i * sig_byte_len, (i + 1) * sig_byte_len)`. Throws `std::invalid_argument`, if `sigs_bytes` can't hold exactly `msgs.size()` signatures.
+  //
+  // Key dependent setup is shared across the batch, as are the copy of `[[s]]` and the random number generators, which are set up once per batch, not
+  // once per message. If a thread pool is supplied, the batch is split into contiguous chunks, one of them signed on the calling thread, while others are
+  // signed on the pool, each with its own copy of `[[s]]` and its own randomness, living on heap and wiped when released. Returns only after all chunks
+  // return.
+  //
+  // If a chunk throws, remaining chunks stop early and the first exception is rethrown to the caller, once all of them have returned. When called from a
+  // worker thread of `pool` itself, the whole batch is signed on the calling thread, as waiting on the same pool could deadlock.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  void sign_batch(std::span<const std::span<const uint8_t>> msgs,
+                  std::span<uint8_t> sigs_bytes,
+                  raccoon_thread_pool::thread_pool_t* const pool = nullptr) const
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    if (sigs_bytes.size() != msgs.size() * sig_byte_len) {
+      throw std::invalid_argument("signature buffer must be able to hold exactly one signature per message");
+    }
+    if (msgs.empty()) {
+      return;
+    }
+
+    const bool is_parallel = (pool != nullptr) && !pool->is_worker_thread();
+    const size_t num_chunks = is_parallel ? std::min(pool->num_threads() + 1, msgs.size()) : 1;
+    const size_t chunk_len = (msgs.size() + num_chunks - 1) / num_chunks;
+
+    std::stop_source stop{};
+    std::latch finished(static_cast<std::ptrdiff_t>(num_chunks - 1));
+
+    std::mutex error_lock{};
+    std::exception_ptr error{};
+
+    // Signs messages in [from, to), one after another, until another chunk fails
+    const auto sign_chunk = [&](const size_t from, const size_t to) {
+      auto s = raccoon_workspace::make_secure<raccoon_poly_vec::poly_vec_t<l, d>>(this->skey.get_s());
+      auto ws = raccoon_workspace::make_secure<raccoon_workspace::attempt_workspace_t<k, l, d>>();
+
+      prng::prng_t prng{};
+      mrng::mrng_t<d> mrng{};
+
+      std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+
+      for (size_t i = from; (i < to) && !stop.stop_requested(); i++) {
+        raccoon_challenge::msg_hash<𝜅>(this->pk_digest, msgs[i], 𝜇);
+        auto sig_bytes = sigs_bytes.subspan(i * sig_byte_len).template first<sig_byte_len>();
+
+        while (true) {
+          skey_t<𝜅, k, l, d, 𝜈t>::template commit<𝑢w, 𝜈w, rep>(this->A, ws->r, ws->w, ws->w_prime, prng, mrng);
+
+          const bool is_signed =
+            skey_t<𝜅, k, l, d, 𝜈t>::template respond<𝜈w, 𝜔, sig_byte_len, Binf, B22>(this->A, this->t, *s, 𝜇, ws->r, ws->w_prime, mrng, sig_bytes);
+          if (is_signed) {
+            break;
+          }
+        }
+      }
+    };
+
+    // Signs a chunk, keeping the first exception thrown by any of them and requesting others to stop.
+    const auto guarded_chunk = [&](const size_t from, const size_t to) {
+      try {
+        sign_chunk(from, to);
+      } catch (...) {
+        {
+          std::scoped_lock guard(error_lock);
+          if (!error) {
+            error = std::current_exception();
+          }
+        }
+        stop.request_stop();
+      }
+    };
+
+    size_t num_submitted = 0;
+    try {
+      for (; num_submitted < num_chunks - 1; num_submitted++) {
+        const size_t from = std::min((num_submitted + 1) * chunk_len, msgs.size());
+        const size_t to = std::min(from + chunk_len, msgs.size());
+
+        pool->submit([&, from, to] {
+          raccoon_thread_pool::count_down_guard_t guard{ finished };
+          guarded_chunk(from, to);
+        });
+      }
+    } catch (...) {
+      // Chunks, which couldn't be submitted, are never going to count down, hence they're accounted for here
+      finished.count_down(static_cast<std::ptrdiff_t>(num_chunks - 1 - num_submitted));
+      stop.request_stop();
+      finished.wait();
+
+      throw;
+    }
+
+    guarded_chunk(0, std::min(chunk_len, msgs.size()));
+    finished.wait();
+
+    // All chunks have returned, hence they no longer touch `error`
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  // Computes a fresh presignature i.e. message independent commitment, following steps 4-9 of algorithm 2 of the specification, which can later be
+  // consumed by online signing. This is the offline phase of signing.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep>
+  typename raccoon_presig::presig_pool_t<𝜅, k, l, d>::presig_ptr_t presign() const
+  {
+    prng::prng_t prng{};
+    mrng::mrng_t<d> mrng{};
+
+    auto presig = raccoon_workspace::make_secure<raccoon_presig::presig_t<𝜅, k, l, d>>();
+    skey_t<𝜅, k, l, d, 𝜈t>::template commit<𝑢w, 𝜈w, rep>(this->A, presig->r, presig->w_prime, prng, mrng);
+    presig->pk_digest = this->pk_digest;
+
+    return presig;
+  }
+
+  // Tops up the pool with fresh presignatures, until it is full, without blocking.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep>
+  void refill(raccoon_presig::presig_pool_t<𝜅, k, l, d>& pool) const
+  {
+    while (!pool.full()) {
+      if (!pool.try_push(this->template presign<𝑢w, 𝜈w, rep>())) {
+        break;
+      }
+    }
+  }
+
+  // Keeps filling the pool with fresh presignatures, blocking while it is full, until stop is requested. Meant to be run on a background worker thread.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep>
+  void produce(raccoon_presig::presig_pool_t<𝜅, k, l, d>& pool, std::stop_token stoken) const
+  {
+    while (!stoken.stop_requested()) {
+      if (!pool.push(this->template presign<𝑢w, 𝜈w, rep>(), stoken)) {
+        break;
+      }
+    }
+  }
+
+  // Signs, given `2 * 𝜅` -bit digest 𝜇, binding the public key with the message, which was already computed by the caller. First signing attempt consumes
+  // the supplied presignature, if any, while subsequent attempts compute their commitment inline. Throws `std::invalid_argument`, if the supplied
+  // presignature was computed under another key.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  void sign_digest(std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇,
+                   std::span<uint8_t, sig_byte_len> sig_bytes,
+                   typename raccoon_presig::presig_pool_t<𝜅, k, l, d>::presig_ptr_t presig = nullptr) const
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    if (presig) {
+      this->check_presig(*presig);
+    }
+
+    auto s = this->skey.get_s();
+    mrng::mrng_t<d> mrng{};
+
+    while (true) {
+      if (!presig) {
+        presig = this->template presign<𝑢w, 𝜈w, rep>();
+      }
+
+      const bool is_signed = skey_t<𝜅, k, l, d, 𝜈t>::template respond<𝜈w, 𝜔, sig_byte_len, Binf, B22>(
+        this->A, this->t, s, 𝜇, presig->r, presig->w_prime, mrng, sig_bytes);
+      if (is_signed) {
+        break;
+      }
+
+      presig.reset();
+    }
+  }
+
+  // Signs a message of arbitrary length, consuming one presignature from the pool per signing attempt, so that only steps 10-20 of algorithm 2 of the
+  // specification are computed on the online path. If the pool runs dry, commitment is computed inline, instead of waiting for the producer.
+  //
+  // Each consumed presignature is dropped after its signing attempt, irrespective of the outcome. Throws `std::invalid_argument`, if the pool hands out a
+  // presignature, which was computed under another key, dropping it, as a pool must be filled by the same key, which drains it.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  void sign(std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes, raccoon_presig::presig_pool_t<𝜅, k, l, d>& pool) const
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    auto s = this->skey.get_s();
+
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    raccoon_challenge::msg_hash<𝜅>(this->pk_digest, msg, 𝜇);
+
+    mrng::mrng_t<d> mrng{};
+
+    while (true) {
+      auto presig = pool.try_pop();
+      if (!presig) {
+        presig = this->template presign<𝑢w, 𝜈w, rep>();
+      }
+      this->check_presig(*presig);
+
+      const bool is_signed = skey_t<𝜅, k, l, d, 𝜈t>::template respond<𝜈w, 𝜔, sig_byte_len, Binf, B22>(
+        this->A, this->t, s, 𝜇, presig->r, presig->w_prime, mrng, sig_bytes);
+      if (is_signed) {
+        break;
+      }
+    }
+  }
+};
+
+// Raccoon Secret Key, prepared for signing many messages concurrently, from many threads, without ever copying the masked secret key vector `[[s]]` in
+// the signing path. It keeps public matrix A, `t << 𝜈t` and digest of the public key resident, along with a fixed number of independently refreshed
+// share sets of `[[s]]`, each guarded by its own lock. A signing call claims a free share set, refreshing it in place, while signing. Ideally number of
+// share sets should match number of threads signing concurrently, so that no call has to wait for a share set.
+template<size_t 𝜅, size_t k, size_t l, size_t d, size_t 𝜈t>
+struct pooled_skey_t
+{
+private:
+  struct share_set_t
+  {
+    std::mutex lock{};
+    raccoon_poly_vec::poly_vec_t<l, d> s{};
+  };
+
+  raccoon_poly_mat::poly_mat_t<k, l> A{};
+  raccoon_poly_vec::poly_vec_t<k, 1> t{};
+  std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> pk_digest{};
+
+  std::vector<std::unique_ptr<share_set_t>> share_sets{};
+  std::atomic<size_t> next_share_set{ 0 };
+
+  // Claims a share set, preferring any free one, starting from a rotating position, else waits for the one at the starting position.
+  std::unique_lock<std::mutex> claim(share_set_t*& share_set)
+  {
+    const size_t num_share_sets = this->share_sets.size();
+    const size_t start = this->next_share_set.fetch_add(1, std::memory_order_relaxed) % num_share_sets;
+
+    for (size_t i = 0; i < num_share_sets; i++) {
+      share_set = this->share_sets[(start + i) % num_share_sets].get();
+
+      std::unique_lock guard(share_set->lock, std::try_to_lock);
+      if (guard.owns_lock()) {
+        return guard;
+      }
+    }
+
+    share_set = this->share_sets[start].get();
+    return std::unique_lock(share_set->lock);
+  }
+
+public:
+  // Constructor(s), setting up `num_share_sets` (>0) -many share sets, each one being an independently refreshed copy of `[[s]]`.
+  pooled_skey_t(const skey_t<𝜅, k, l, d, 𝜈t>& skey, const size_t num_share_sets)
+  {
+    this->A = skey.get_pkey().template expand_A<l>();
+    this->t = skey.get_pkey().get_scaled_t_ntt();
+    skey.get_pkey().hash(this->pk_digest);
+
+    mrng::mrng_t<d> mrng{};
+
+    this->share_sets.reserve(std::max<size_t>(num_share_sets, 1));
+    for (size_t i = 0; i < std::max<size_t>(num_share_sets, 1); i++) {
+      auto share_set = std::make_unique<share_set_t>();
+      share_set->s = skey.get_s();
+      share_set->s.refresh(mrng);
+
+      this->share_sets.push_back(std::move(share_set));
+    }
+  }
+
+  pooled_skey_t(const pooled_skey_t&) = delete;
+  pooled_skey_t& operator=(const pooled_skey_t&) = delete;
+
+  // Number of share sets, held by this secret key.
+  size_t num_share_sets() const { return this->share_sets.size(); }
+
+  // Signs a message of arbitrary length, producing a byte serialized signature, while refreshing the claimed share set in place. Safe to be called
+  // concurrently, from many threads.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  void sign(std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes)
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    raccoon_challenge::msg_hash<𝜅>(this->pk_digest, msg, 𝜇);
+
+    share_set_t* share_set = nullptr;
+    const auto guard = this->claim(share_set);
+
+    skey_t<𝜅, k, l, d, 𝜈t>::template sign_with<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(this->A, this->t, share_set->s, 𝜇, sig_bytes);
+  }
+};
+
+// Raccoon Secret Key, prepared for signing many messages from many threads concurrently, while shares of `[[s]]` are refreshed on a background thread,
+// instead of on the signing path. It keeps public matrix A, `t << 𝜈t` and digest of the public key resident, along with two buffers of `[[s]]`, following
+// an epoch based read-copy-update scheme
+//
+// - signers copy `[[s]]` from the buffer of current epoch, pinning it by a reader count only while copying, so they never take a lock
+// - refresher waits for readers of the standby buffer to drain, fills it with a freshly refreshed copy of the current one and publishes it as next epoch
+//
+// Each signer keeps its own copy of `[[s]]` in a workspace, either supplied by the caller or kept per thread, which it copies only when the key has moved
+// on to another epoch, since it last copied, i.e. at most once per epoch, not once per call. In between, the copy is refreshed in place, in each signing
+// attempt, same as step 12 of algorithm 2 of the specification, so that no two attempts ever use the same shares.
+template<size_t 𝜅, size_t k, size_t l, size_t d, size_t 𝜈t>
+struct epoch_skey_t
+{
+private:
+  using workspace_t = raccoon_workspace::epoch_sign_workspace_t<k, l, d>;
+
+  struct share_buf_t
+  {
+    std::atomic<size_t> readers{ 0 };
+    raccoon_poly_vec::poly_vec_t<l, d> s{};
+  };
+
+  // Identifies this key, among all epoch keys of the process, so that a workspace can tell whose shares it holds. Never zero.
+  inline static std::atomic<uint64_t> next_key_id{ 1 };
+  const uint64_t key_id = next_key_id.fetch_add(1, std::memory_order_relaxed);
+
+  // Workspace of the calling thread, shared by all epoch keys of this parameter set, which holds shares of the key, the thread last signed with.
+  inline static thread_local raccoon_workspace::secure_ptr_t<workspace_t> thread_ws{};
+
+  raccoon_poly_mat::poly_mat_t<k, l> A{};
+  raccoon_poly_vec::poly_vec_t<k, 1> t{};
+  std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> pk_digest{};
+
+  std::array<std::unique_ptr<share_buf_t>, 2> share_bufs{};
+  std::atomic<uint64_t> cur_epoch{ 0 };
+  std::atomic<uint64_t> num_sigs{ 0 };
+
+  raccoon_sign_policy::refresh_cadence_t cadence{};
+
+  // Refresher sleeps on the semaphore, which is released only when `refresh_requested` flips from false to true, so that it never exceeds 1. Refresher
+  // flips it back, only after acquiring the semaphore. Neither side ever takes a lock.
+  std::binary_semaphore refresh_due{ 0 };
+  std::atomic<bool> refresh_requested{ false };
+  std::jthread refresher{};
+
+  // Copies shares of current epoch into `s`, pinning their buffer, so that it is not overwritten while being copied. Returns the epoch, copied from.
+  uint64_t copy_shares(raccoon_poly_vec::poly_vec_t<l, d>& s)
+  {
+    while (true) {
+      const uint64_t epoch = this->cur_epoch.load();
+      auto& share_buf = *this->share_bufs[epoch & 1];
+
+      share_buf.readers.fetch_add(1);
+      if (this->cur_epoch.load() == epoch) {
+        s = share_buf.s;
+        share_buf.readers.fetch_sub(1);
+
+        return epoch;
+      }
+
+      // Refresher moved on to next epoch, in between, hence it may be overwriting this buffer
+      share_buf.readers.fetch_sub(1);
+    }
+  }
+
+  // Moves on to next epoch, publishing a freshly refreshed copy of `[[s]]`. Only called by the refresher.
+  void advance(mrng::mrng_t<d>& mrng)
+  {
+    const uint64_t epoch = this->cur_epoch.load();
+    const auto& active = *this->share_bufs[epoch & 1];
+    auto& standby = *this->share_bufs[(epoch + 1) & 1];
+
+    // Wait for signers, still reading shares of previous epoch, to finish
+    while (standby.readers.load() != 0) {
+      std::this_thread::yield();
+    }
+
+    standby.s = active.s;
+    standby.s.refresh(mrng);
+
+    this->cur_epoch.store(epoch + 1);
+  }
+
+  // Wakes up the refresher, without ever blocking.
+  void wake_refresher()
+  {
+    if (!this->refresh_requested.exchange(true)) {
+      this->refresh_due.release();
+    }
+  }
+
+  // Keeps refreshing shares, as per the refresh cadence, until stop is requested.
+  void refresh_loop(std::stop_token stoken)
+  {
+    mrng::mrng_t<d> mrng{};
+
+    while (!stoken.stop_requested()) {
+      bool is_requested = true;
+      if (this->cadence.interval.count() > 0) {
+        is_requested = this->refresh_due.try_acquire_for(this->cadence.interval);
+      } else {
+        this->refresh_due.acquire();
+      }
+
+      if (stoken.stop_requested()) {
+        break;
+      }
+
+      if (is_requested) {
+        this->refresh_requested.store(false);
+      }
+      this->advance(mrng);
+    }
+  }
+
+  // Wipes ephemeral secrets of the workspace, once signing returns, along with its copy of `[[s]]`, if signing throws, as its shares may then be left
+  // half refreshed.
+  struct wipe_guard_t
+  {
+    workspace_t& ws;
+    const int num_uncaught = std::uncaught_exceptions();
+
+    ~wipe_guard_t()
+    {
+      if (std::uncaught_exceptions() > this->num_uncaught) {
+        this->ws.clear();
+      } else {
+        this->ws.clear_attempt();
+      }
+    }
+  };
+
+  // Signs using the copy of shares, held in given workspace, which is taken afresh only if it's from another key or another epoch, refreshing it in
+  // each signing attempt.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  void sign_using(std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes, workspace_t& ws)
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    raccoon_challenge::msg_hash<𝜅>(this->pk_digest, msg, 𝜇);
+
+    const wipe_guard_t guard{ ws };
+
+    // Key may move on to next epoch right after this check, in which case shares of the previous epoch get used, which are still being refreshed
+    if ((ws.key_id != this->key_id) || (ws.epoch != this->cur_epoch.load())) {
+      ws.key_id = 0;
+      ws.epoch = this->copy_shares(ws.s);
+      ws.key_id = this->key_id;
+    }
+
+    skey_t<𝜅, k, l, d, 𝜈t>::template sign_with<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(this->A, this->t, ws.s, 𝜇, sig_bytes, ws.attempt);
+
+    const uint64_t sig_count = this->num_sigs.fetch_add(1, std::memory_order_relaxed) + 1;
+    if ((this->cadence.num_sigs > 0) && (sig_count % this->cadence.num_sigs == 0)) {
+      this->wake_refresher();
+    }
+  }
+
+public:
+  // Constructor(s), starting the background refresher, which refreshes shares of `[[s]]` as per given cadence. Throws `std::invalid_argument`, if both
+  // triggers of the cadence are disabled, as shares would then never be refreshed in the background.
+  epoch_skey_t(const skey_t<𝜅, k, l, d, 𝜈t>& skey, const raccoon_sign_policy::refresh_cadence_t cadence)
+    : cadence(cadence)
+  {
+    if ((cadence.num_sigs == 0) && (cadence.interval.count() <= 0)) {
+      throw std::invalid_argument("refresh cadence must enable at least one trigger");
+    }
+
+    this->A = skey.get_pkey().template expand_A<l>();
+    this->t = skey.get_pkey().get_scaled_t_ntt();
+    skey.get_pkey().hash(this->pk_digest);
+
+    for (auto& share_buf : this->share_bufs) {
+      share_buf = std::make_unique<share_buf_t>();
+    }
+
+    mrng::mrng_t<d> mrng{};
+    this->share_bufs[0]->s = skey.get_s();
+    this->share_bufs[0]->s.refresh(mrng);
+
+    this->refresher = std::jthread([this](std::stop_token stoken) { this->refresh_loop(stoken); });
+  }
+
+  epoch_skey_t(const epoch_skey_t&) = delete;
+  epoch_skey_t& operator=(const epoch_skey_t&) = delete;
+
+  // Stops the background refresher, before shares go away, wiping them, along with the copy held by the calling thread's workspace. Copies held by
+  // workspaces of other threads are wiped, when those threads sign using another epoch key of the same parameter set or exit, while caller supplied
+  // workspaces are to be cleared by the caller.
+  ~epoch_skey_t()
+  {
+    this->refresher.request_stop();
+    this->wake_refresher();
+    if (this->refresher.joinable()) {
+      this->refresher.join();
+    }
+
+    for (auto& share_buf : this->share_bufs) {
+      raccoon_workspace::secure_zero(share_buf->s);
+    }
+
+    if (thread_ws && (thread_ws->key_id == this->key_id)) {
+      thread_ws->clear();
+    }
+  }
+
+  // Current epoch i.e. number of times shares of `[[s]]` have been refreshed, by the background refresher.
+  uint64_t epoch() const { return this->cur_epoch.load(); }
+
+  // Requests the background refresher to refresh shares of `[[s]]`, without waiting for it.
+  void refresh() { this->wake_refresher(); }
+
+  // Signs a message of arbitrary length, producing a byte serialized signature. Safe to be called concurrently, from many threads. Signers never wait on
+  // each other or on the refresher, not even for requesting a refresh, once every `num_sigs` -many signatures. Copy of `[[s]]` and intermediates of
+  // signing attempts live in a workspace, allocated once per thread, on first call, and reused across calls. Ephemeral secrets are wiped after each call.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  void sign(std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes)
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    if (!thread_ws) {
+      thread_ws = raccoon_workspace::make_secure<workspace_t>();
+    }
+
+    this->sign_using<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(msg, sig_bytes, *thread_ws);
+  }
+
+  // Same as above, but keeps copy of `[[s]]` and intermediates of signing attempts in caller supplied workspace, which must not be shared by concurrent
+  // signers. It can be shared by many epoch keys, as it remembers the key, whose shares it holds.
+  template<size_t 𝑢w, size_t 𝜈w, size_t rep, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  void sign(std::span<const uint8_t> msg, std::span<uint8_t, sig_byte_len> sig_bytes, workspace_t& ws)
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    this->sign_using<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(msg, sig_bytes, ws);
+  }
+};
+
 }
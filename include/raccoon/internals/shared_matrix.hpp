@@ -0,0 +1,86 @@
+#pragma once
+#include "raccoon/internals/polynomial/poly_mat.hpp"
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+
+// Public matrix A, shared by all keys of a deployment, instead of being expanded from the seed of each public key
+namespace raccoon_shared_matrix {
+
+// Public matrix A, expanded once from a deployment-wide seed and kept in its NTT representation, so that key generation, signing and verification, using
+// keys which carry the same seed, never expand A again.
+//
+// Note, this is a deviation from the specification, where each key generation samples a fresh seed, hence a fresh matrix A. Keys generated under a shared
+// matrix are still well-formed Raccoon keys, carrying the shared seed, and their signatures verify under any conforming verifier.
+template<size_t 𝜅, size_t k, size_t l>
+struct shared_matrix_t
+{
+private:
+  std::array<uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits> seed{};
+  raccoon_poly_mat::poly_mat_t<k, l> A{};
+
+public:
+  // Constructor(s)
+  explicit shared_matrix_t(std::span<const uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits> seed)
+  {
+    std::copy(seed.begin(), seed.end(), this->seed.begin());
+    raccoon_poly_mat::poly_mat_t<k, l>::template expandA<k, l, 𝜅>(this->seed, this->A);
+  }
+
+  shared_matrix_t(const shared_matrix_t&) = delete;
+  shared_matrix_t& operator=(const shared_matrix_t&) = delete;
+
+  // Accessor(s)
+  std::span<const uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits> get_seed() const { return this->seed; }
+  const raccoon_poly_mat::poly_mat_t<k, l>& get_A() const { return this->A; }
+
+  // Checks whether given seed ( of a public key ) is the one, this matrix was expanded from. Seed is public, hence it's compared in variable-time.
+  bool is_expanded_from(std::span<const uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits> seed) const
+  {
+    return std::ranges::equal(this->seed, seed);
+  }
+
+  // Returns the process-wide shared matrix, expanded from given seed, expanding it only if no live matrix of that seed exists. Safe to call concurrently.
+  //
+  // Registry only holds weak references, hence a matrix goes away, along with the last key using it, and registry entries of such matrices are dropped,
+  // on next insertion. Expansion happens outside of the lock, so that requests for other seeds, or for already expanded ones, never wait on it. Threads
+  // racing to expand the same seed may each expand it, but all of them end up with the one matrix, which got registered first.
+  static std::shared_ptr<const shared_matrix_t> get(std::span<const uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits> seed)
+  {
+    using seed_t = std::array<uint8_t, 𝜅 / std::numeric_limits<uint8_t>::digits>;
+
+    static std::mutex lock{};
+    static std::map<seed_t, std::weak_ptr<const shared_matrix_t>> matrices{};
+
+    seed_t key{};
+    std::copy(seed.begin(), seed.end(), key.begin());
+
+    {
+      std::scoped_lock guard(lock);
+
+      const auto it = matrices.find(key);
+      if (it != matrices.end()) {
+        if (auto matrix = it->second.lock()) {
+          return matrix;
+        }
+      }
+    }
+
+    auto expanded = std::make_shared<const shared_matrix_t>(seed);
+
+    std::scoped_lock guard(lock);
+
+    auto& entry = matrices[key];
+    if (auto matrix = entry.lock()) {
+      return matrix;
+    }
+    entry = expanded;
+
+    std::erase_if(matrices, [](const auto& kv) { return kv.second.expired(); });
+    return expanded;
+  }
+};
+
+}
@@ -0,0 +1,590 @@
+#pragma once
+#include "public_key.hpp"
+#include "shake256.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+
+// Cache of expanded public matrices A, living in a shared memory segment, s.t. many verifier processes on the same host expand A of a public key only once
+namespace raccoon_shm_matrix_cache {
+
+// Snapshot of the process-local counters of a shared memory matrix cache.
+struct cache_stats_t
+{
+  uint64_t hits = 0;      // Lookups, which found public matrix A already expanded in the shared segment
+  uint64_t misses = 0;    // Lookups, which expanded public matrix A into the shared segment
+  uint64_t fallbacks = 0; // Lookups, which expanded public matrix A in process-local memory, as every slot of the shared segment was in use
+  uint64_t corrupted = 0; // Slots, which didn't match their digest, when checked by this process ( see `trust_t::checked` )
+};
+
+// How a process treats matrices, published in the segment by any process attached to it.
+enum class trust_t : uint8_t
+{
+  shared,  // Matrices are used as published. Cheapest, but soundness of verification rests on every process attached to the segment
+  checked, // Each published matrix is hashed and checked against the digest stored along with it, once per process, before it's first used
+};
+
+// Cache of public matrices A, in their NTT representation, keyed by seed of the public key, living in a POSIX shared memory object or in a memfd, which
+// can be attached to by any number of processes. Segment is laid out as a header, carrying the parameter set ( 𝜅, k, l ) and number of slots, followed by
+// fixed size slots, each holding one expanded matrix, so that it's used in place, without copying it to process-local memory.
+//
+// Each slot carries a 64 -bit state word s.t. bits [63:32] hold its generation, bumped each time a matrix is published in the slot, bit 31 marks a slot
+// being written and bits [30:0] count readers, which hold the slot pinned. Lookups are lock-free: a reader pins a published slot with a compare-and-swap,
+// while a writer claims only an unpinned slot, preferring an empty one, else the least recently used one, as per a segment-wide clock. When all slots are
+// pinned, matrix gets expanded in process-local memory instead. Two processes missing on the same seed, at the same time, may both publish it, in which
+// case the duplicate slot simply ages out.
+//
+// Segment is initialized by whichever attaching process first swaps the header's magic word from zero to an in-progress marker, carrying its pid. If that
+// process dies before finishing, next attaching process finds the marker's pid gone, takes over and initializes the segment afresh.
+//
+// Trust boundary: any process, which can attach to the segment, can rewrite matrix A of any seed, making every other attached process accept forgeries or
+// reject valid signatures, under keys with that seed. Hence all attached processes must be equally trusted. Named segments are created with mode 0600,
+// confining them to processes of the same user, while a memfd is reachable only by those, its file descriptor is handed to. Along with each matrix, its
+// writer stores a SHAKE256 digest of ( parameter set || seed || A ), which processes attaching with `trust_t::checked` check once per published matrix,
+// before first using it. That catches corrupted or torn slots, left behind by buggy processes, but not a malicious one, which can rewrite the digest too.
+//
+// Note, slots pinned or being written by a process, which dies, stay so, until the segment is recreated.
+template<size_t 𝜅, size_t k, size_t l>
+struct shm_matrix_cache_t : public std::enable_shared_from_this<shm_matrix_cache_t<𝜅, k, l>>
+{
+public:
+  using matrix_t = raccoon_poly_mat::poly_mat_t<k, l>;
+  static constexpr size_t SEED_BYTE_LEN = 𝜅 / std::numeric_limits<uint8_t>::digits;
+  static constexpr size_t DIGEST_BYTE_LEN = 32;
+
+private:
+  static constexpr uint64_t MAGIC = 0x6d68735f6e6f6f63ul;    // "coon_shm", in little-endian
+  static constexpr uint64_t INIT_TAG = 0x74696e6900000000ul; // "init" in upper half, pid of the initializing process in lower half
+  static constexpr uint64_t VERSION = 2;
+
+  static constexpr uint64_t BUSY = 1ul << 31;
+  static constexpr uint64_t PINS = BUSY - 1;
+  static constexpr uint64_t GEN_ONE = 1ul << 32;
+
+  struct alignas(64) header_t
+  {
+    uint64_t magic;
+    uint64_t version;
+    uint64_t params[4];
+    uint64_t num_slots;
+    uint64_t clock;
+  };
+
+  struct alignas(64) slot_t
+  {
+    uint64_t state;
+    uint64_t last_used;
+    uint64_t tag;
+    uint8_t seed[SEED_BYTE_LEN];
+    uint8_t digest[DIGEST_BYTE_LEN];
+  };
+
+  static_assert(std::atomic_ref<uint64_t>::is_always_lock_free, "Shared memory matrix cache needs lock-free 64 -bit atomics");
+  static_assert(std::is_trivially_copyable_v<matrix_t>, "Public matrix must be trivially copyable, to live in shared memory");
+
+  uint8_t* base = nullptr;
+  size_t byte_len = 0;
+  size_t num_slots = 0;
+  trust_t trust = trust_t::shared;
+
+  // Generation of the matrix, this process has checked against its digest, for each slot, if attached with `trust_t::checked`. Zero means none.
+  std::unique_ptr<std::atomic<uint64_t>[]> checked_gens{};
+
+  mutable std::atomic<uint64_t> hits{ 0 };
+  mutable std::atomic<uint64_t> misses{ 0 };
+  mutable std::atomic<uint64_t> fallbacks{ 0 };
+  mutable std::atomic<uint64_t> corrupted{ 0 };
+
+  // Private tag for constructing the cache, only through `open` and `attach`.
+  struct private_t
+  {
+  };
+
+  static constexpr size_t slots_offset() { return sizeof(header_t); }
+  static constexpr size_t matrices_offset(const size_t num_slots) { return sizeof(header_t) + num_slots * sizeof(slot_t); }
+
+  header_t& header() const { return *std::launder(reinterpret_cast<header_t*>(this->base)); }
+  slot_t& slot(const size_t idx) const { return *std::launder(reinterpret_cast<slot_t*>(this->base + slots_offset()) + idx); }
+  matrix_t* matrix(const size_t idx) const { return std::launder(reinterpret_cast<matrix_t*>(this->base + matrices_offset(this->num_slots)) + idx); }
+
+  static std::atomic_ref<uint64_t> atomic(uint64_t& word) { return std::atomic_ref<uint64_t>(word); }
+
+  // First 8 bytes of the seed, compared before pinning a slot, so that lookups don't pin slots holding other matrices.
+  static uint64_t seed_tag(std::span<const uint8_t, SEED_BYTE_LEN> seed) { return raccoon_utils::from_le_bytes<uint64_t>(seed.template first<8>()); }
+
+  // Computes SHAKE256 digest of ( parameter set || seed || A ), stored along with each published matrix.
+  static void digest_of(std::span<const uint8_t, SEED_BYTE_LEN> seed, const matrix_t& A, std::span<uint8_t, DIGEST_BYTE_LEN> digest)
+  {
+    std::array<uint8_t, 4 * sizeof(uint64_t)> params{};
+    const uint64_t param_words[4]{ 𝜅, k, l, raccoon_poly::N };
+    for (size_t i = 0; i < 4; i++) {
+      raccoon_utils::to_le_bytes(param_words[i], std::span(params).subspan(i * sizeof(uint64_t), sizeof(uint64_t)));
+    }
+
+    shake256::shake256_t hasher{};
+    hasher.absorb(params);
+    hasher.absorb(seed);
+    hasher.absorb(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(&A), sizeof(A)));
+    hasher.finalize();
+    hasher.squeeze(digest);
+  }
+
+  static void throw_errno(const char* what) { throw std::system_error(errno, std::generic_category(), what); }
+
+  // Whether the process, which left its pid in an in-progress marker, is gone.
+  static bool is_initializer_gone(const uint64_t marker)
+  {
+    const auto pid = static_cast<pid_t>(marker & 0xfffffffful);
+    return (pid != getpid()) && (kill(pid, 0) != 0) && (errno == ESRCH);
+  }
+
+  // Initializes header and slots of the segment, after having won the right to do so. Slots are emptied, as a previous initializer may have died midway.
+  void initialize(const uint64_t marker)
+  {
+    auto& hdr = this->header();
+
+    std::memset(this->base + sizeof(hdr.magic), 0, matrices_offset(this->num_slots) - sizeof(hdr.magic));
+    if (atomic(hdr.magic).load(std::memory_order_relaxed) != marker) {
+      // Can only happen, if this process was considered gone and another one took over, in which case it's left to that one
+      return;
+    }
+
+    hdr.version = VERSION;
+    hdr.params[0] = 𝜅;
+    hdr.params[1] = k;
+    hdr.params[2] = l;
+    hdr.params[3] = raccoon_poly::N;
+    hdr.num_slots = this->num_slots;
+
+    uint64_t expected = marker;
+    atomic(hdr.magic).compare_exchange_strong(expected, MAGIC, std::memory_order_release, std::memory_order_relaxed);
+  }
+
+  // Maps `fd` holding a segment of `num_slots` slots, sizing it, if it's empty, then either initializes it, if no process has done so, or waits for the
+  // one doing so, taking over, if it's gone. Finally, checks that the segment was created for the same parameter set and number of slots.
+  void map(const int fd, const size_t num_slots, const trust_t trust)
+  {
+    this->num_slots = num_slots;
+    this->trust = trust;
+    this->byte_len = matrices_offset(num_slots) + num_slots * sizeof(matrix_t);
+
+    struct stat st{};
+    if (fstat(fd, &st) != 0) {
+      throw_errno("fstat on shared memory matrix cache failed");
+    }
+
+    // Many processes may race to size an empty segment, which is fine, as they all agree on its byte length, else they throw below
+    if (st.st_size == 0) {
+      if (ftruncate(fd, static_cast<off_t>(this->byte_len)) != 0) {
+        throw_errno("ftruncate on shared memory matrix cache failed");
+      }
+      if (fstat(fd, &st) != 0) {
+        throw_errno("fstat on shared memory matrix cache failed");
+      }
+    }
+
+    if (static_cast<size_t>(st.st_size) != this->byte_len) {
+      throw std::invalid_argument("shared memory matrix cache has unexpected byte length");
+    }
+
+    void* addr = mmap(nullptr, this->byte_len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+      throw_errno("mmap of shared memory matrix cache failed");
+    }
+    this->base = static_cast<uint8_t*>(addr);
+
+    auto& hdr = this->header();
+    auto magic = atomic(hdr.magic);
+    const uint64_t marker = INIT_TAG | static_cast<uint64_t>(static_cast<uint32_t>(getpid()));
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (true) {
+      uint64_t cur = magic.load(std::memory_order_acquire);
+      if (cur == MAGIC) {
+        break;
+      }
+
+      const bool is_free = cur == 0;
+      const bool is_abandoned = ((cur & ~0xfffffffful) == INIT_TAG) && is_initializer_gone(cur);
+
+      if ((is_free || is_abandoned) && magic.compare_exchange_strong(cur, marker, std::memory_order_acquire, std::memory_order_relaxed)) {
+        this->initialize(marker);
+        continue;
+      }
+
+      if (std::chrono::steady_clock::now() > deadline) {
+        throw std::invalid_argument("shared memory matrix cache was never initialized");
+      }
+      std::this_thread::yield();
+    }
+
+    if ((hdr.version != VERSION) || (hdr.params[0] != 𝜅) || (hdr.params[1] != k) || (hdr.params[2] != l) || (hdr.params[3] != raccoon_poly::N) ||
+        (hdr.num_slots != num_slots)) {
+      throw std::invalid_argument("shared memory matrix cache was created for another parameter set or number of slots");
+    }
+
+    if (trust == trust_t::checked) {
+      this->checked_gens = std::make_unique<std::atomic<uint64_t>[]>(num_slots);
+    }
+  }
+
+  // Checks matrix of a pinned slot against its digest, once per published generation, if attached with `trust_t::checked`. Returns false, if it doesn't
+  // match, in which case the slot is not to be used.
+  bool is_intact(const size_t idx, const uint64_t gen) const
+  {
+    if (this->trust != trust_t::checked) {
+      return true;
+    }
+
+    auto& checked_gen = this->checked_gens[idx];
+    if (checked_gen.load(std::memory_order_relaxed) == gen) {
+      return true;
+    }
+
+    // Slot can't be rewritten, while it's pinned, hence neither its seed, nor its matrix, nor its digest change, while being checked
+    const auto& s = this->slot(idx);
+
+    std::array<uint8_t, DIGEST_BYTE_LEN> digest{};
+    digest_of(std::span<const uint8_t, SEED_BYTE_LEN>(s.seed), *this->matrix(idx), digest);
+
+    if (!std::equal(digest.begin(), digest.end(), std::begin(s.digest))) {
+      this->corrupted.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    checked_gen.store(gen, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Pins the slot holding the matrix expanded from given seed, returning its index, else returns `num_slots`.
+  size_t pin(std::span<const uint8_t, SEED_BYTE_LEN> seed) const
+  {
+    const uint64_t tag = seed_tag(seed);
+
+    for (size_t idx = 0; idx < this->num_slots; idx++) {
+      auto& s = this->slot(idx);
+      auto state = atomic(s.state);
+
+      if (atomic(s.tag).load(std::memory_order_relaxed) != tag) {
+        continue;
+      }
+
+      uint64_t cur = state.load(std::memory_order_relaxed);
+      bool is_pinned = false;
+
+      while (((cur & BUSY) == 0) && (cur >= GEN_ONE) && ((cur & PINS) != PINS)) {
+        if (state.compare_exchange_weak(cur, cur + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+          is_pinned = true;
+          break;
+        }
+      }
+
+      if (!is_pinned) {
+        continue;
+      }
+
+      // Slot can't be rewritten, while it's pinned, hence its seed is stable
+      if (std::equal(seed.begin(), seed.end(), std::begin(s.seed)) && this->is_intact(idx, cur >> 32)) {
+        atomic(s.last_used).store(atomic(this->header().clock).fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+        return idx;
+      }
+
+      state.fetch_sub(1, std::memory_order_release);
+    }
+
+    return this->num_slots;
+  }
+
+  // Claims an unpinned slot for writing, preferring an empty one, else the least recently used one. Returns its index and state before claiming it, else
+  // returns `num_slots`, if every slot is in use.
+  std::pair<size_t, uint64_t> claim() const
+  {
+    for (size_t attempt = 0; attempt < 4; attempt++) {
+      size_t victim = this->num_slots;
+      uint64_t victim_used = std::numeric_limits<uint64_t>::max();
+      uint64_t victim_state = 0;
+
+      for (size_t idx = 0; idx < this->num_slots; idx++) {
+        auto& s = this->slot(idx);
+
+        const uint64_t cur = atomic(s.state).load(std::memory_order_relaxed);
+        if ((cur & (BUSY | PINS)) != 0) {
+          continue;
+        }
+
+        const uint64_t used = (cur < GEN_ONE) ? 0 : atomic(s.last_used).load(std::memory_order_relaxed) + 1;
+        if (used < victim_used) {
+          victim = idx;
+          victim_used = used;
+          victim_state = cur;
+        }
+      }
+
+      if (victim == this->num_slots) {
+        break;
+      }
+
+      uint64_t expected = victim_state;
+      if (atomic(this->slot(victim).state).compare_exchange_strong(expected, victim_state | BUSY, std::memory_order_acquire, std::memory_order_relaxed)) {
+        return { victim, victim_state };
+      }
+    }
+
+    return { this->num_slots, 0 };
+  }
+
+public:
+  // Handle to a public matrix A, expanded from a seed, which either pins a slot of the shared segment or owns a process-local matrix. Shared slot stays
+  // pinned, hence can't be evicted, until the handle is destroyed.
+  struct matrix_ref_t
+  {
+  private:
+    std::shared_ptr<const shm_matrix_cache_t> cache{};
+    size_t idx = 0;
+    std::shared_ptr<const matrix_t> local{};
+    const matrix_t* A = nullptr;
+
+    friend struct shm_matrix_cache_t;
+
+    void release()
+    {
+      if (this->cache) {
+        atomic(this->cache->slot(this->idx).state).fetch_sub(1, std::memory_order_release);
+        this->cache.reset();
+      }
+
+      this->local.reset();
+      this->A = nullptr;
+    }
+
+  public:
+    // Constructor(s)
+    matrix_ref_t() = default;
+    matrix_ref_t(const matrix_ref_t&) = delete;
+    matrix_ref_t& operator=(const matrix_ref_t&) = delete;
+
+    matrix_ref_t(matrix_ref_t&& rhs) noexcept
+      : cache(std::move(rhs.cache))
+      , idx(rhs.idx)
+      , local(std::move(rhs.local))
+      , A(std::exchange(rhs.A, nullptr))
+    {
+    }
+
+    matrix_ref_t& operator=(matrix_ref_t&& rhs) noexcept
+    {
+      if (this != &rhs) {
+        this->release();
+
+        this->cache = std::move(rhs.cache);
+        this->idx = rhs.idx;
+        this->local = std::move(rhs.local);
+        this->A = std::exchange(rhs.A, nullptr);
+      }
+
+      return *this;
+    }
+
+    ~matrix_ref_t() { this->release(); }
+
+    // Accessor(s)
+    const matrix_t& get_A() const { return *this->A; }
+    bool is_shared() const { return static_cast<bool>(this->cache); }
+  };
+
+  // Constructor(s), callable only through `open` and `attach`
+  shm_matrix_cache_t(private_t, const int fd, const size_t num_slots, const trust_t trust) { this->map(fd, num_slots, trust); }
+
+  shm_matrix_cache_t(const shm_matrix_cache_t&) = delete;
+  shm_matrix_cache_t& operator=(const shm_matrix_cache_t&) = delete;
+
+  ~shm_matrix_cache_t()
+  {
+    if (this->base != nullptr) {
+      munmap(this->base, this->byte_len);
+    }
+  }
+
+  // Opens the POSIX shared memory object of given name ( see `shm_open(3)` ), holding `num_slots` (>0) -many slots, creating it, if it doesn't exist yet,
+  // or recovering it, if the process, which was initializing it, died midway. Throws `std::system_error`, if it can't be opened or mapped, and
+  // `std::invalid_argument`, if it was created for another parameter set or number of slots.
+  static std::shared_ptr<shm_matrix_cache_t> open(const std::string& name, const size_t num_slots, const trust_t trust = trust_t::shared)
+  {
+    if (num_slots == 0 || num_slots > std::numeric_limits<uint32_t>::max()) {
+      throw std::invalid_argument("shared memory matrix cache must have a non-zero number of slots");
+    }
+
+    const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT, 0600);
+    if (fd < 0) {
+      throw_errno("shm_open of shared memory matrix cache failed");
+    }
+
+    try {
+      auto cache = std::make_shared<shm_matrix_cache_t>(private_t{}, fd, num_slots, trust);
+      close(fd);
+
+      return cache;
+    } catch (...) {
+      close(fd);
+      throw;
+    }
+  }
+
+  // Maps the segment behind given file descriptor e.g. a memfd ( see `memfd_create(2)` ), shared with other processes by inheritance or over a unix socket,
+  // initializing it, if it's empty. Caller keeps owning the file descriptor, which can be closed right after. Throws same as `open`.
+  static std::shared_ptr<shm_matrix_cache_t> attach(const int fd, const size_t num_slots, const trust_t trust = trust_t::shared)
+  {
+    if (num_slots == 0 || num_slots > std::numeric_limits<uint32_t>::max()) {
+      throw std::invalid_argument("shared memory matrix cache must have a non-zero number of slots");
+    }
+
+    return std::make_shared<shm_matrix_cache_t>(private_t{}, fd, num_slots, trust);
+  }
+
+  // Removes the POSIX shared memory object of given name. Processes, which have already opened it, keep using it, until they drop their cache.
+  static void unlink(const std::string& name) { shm_unlink(name.c_str()); }
+
+  // Returns public matrix A, expanded from given seed, in its NTT representation. It's found in the shared segment, if some process has already expanded
+  // it, else it's expanded into an unpinned slot of the segment, else into process-local memory. Safe to call concurrently, from many processes.
+  matrix_ref_t get(std::span<const uint8_t, SEED_BYTE_LEN> seed) const
+  {
+    matrix_ref_t ref{};
+
+    size_t idx = this->pin(seed);
+    if (idx != this->num_slots) {
+      this->hits.fetch_add(1, std::memory_order_relaxed);
+
+      ref.cache = this->shared_from_this();
+      ref.idx = idx;
+      ref.A = this->matrix(idx);
+
+      return ref;
+    }
+
+    const auto [claimed, prev_state] = this->claim();
+    if (claimed == this->num_slots) {
+      this->fallbacks.fetch_add(1, std::memory_order_relaxed);
+
+      auto A = std::make_shared<matrix_t>();
+      matrix_t::template expandA<k, l, 𝜅>(seed, *A);
+
+      ref.local = std::move(A);
+      ref.A = ref.local.get();
+
+      return ref;
+    }
+
+    this->misses.fetch_add(1, std::memory_order_relaxed);
+
+    auto& s = this->slot(claimed);
+    auto* A = std::construct_at(this->matrix(claimed));
+    matrix_t::template expandA<k, l, 𝜅>(seed, *A);
+
+    std::copy(seed.begin(), seed.end(), std::begin(s.seed));
+    digest_of(seed, *A, std::span<uint8_t, DIGEST_BYTE_LEN>(s.digest));
+    atomic(s.tag).store(seed_tag(seed), std::memory_order_relaxed);
+    atomic(s.last_used).store(atomic(this->header().clock).fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+
+    // Publishes the slot under a new generation, already pinned once, for this caller
+    const uint64_t next_gen = (prev_state & ~(BUSY | PINS)) + GEN_ONE;
+    atomic(s.state).store(next_gen | 1, std::memory_order_release);
+
+    if (this->trust == trust_t::checked) {
+      this->checked_gens[claimed].store(next_gen >> 32, std::memory_order_relaxed);
+    }
+
+    ref.cache = this->shared_from_this();
+    ref.idx = claimed;
+    ref.A = A;
+
+    return ref;
+  }
+
+  // Number of slots in the shared segment and its byte length, which is mostly taken by `num_slots` expanded public matrices.
+  size_t get_num_slots() const { return this->num_slots; }
+  size_t get_byte_len() const { return this->byte_len; }
+
+  // Whether this process checks matrices, published in the segment, against their digests.
+  trust_t get_trust() const { return this->trust; }
+
+  // Returns a snapshot of the process-local counters, accumulated since attaching to the segment or since last call to `reset_stats`.
+  cache_stats_t stats() const
+  {
+    return cache_stats_t{
+      .hits = this->hits.load(std::memory_order_relaxed),
+      .misses = this->misses.load(std::memory_order_relaxed),
+      .fallbacks = this->fallbacks.load(std::memory_order_relaxed),
+      .corrupted = this->corrupted.load(std::memory_order_relaxed),
+    };
+  }
+
+  void reset_stats()
+  {
+    this->hits.store(0, std::memory_order_relaxed);
+    this->misses.store(0, std::memory_order_relaxed);
+    this->fallbacks.store(0, std::memory_order_relaxed);
+    this->corrupted.store(0, std::memory_order_relaxed);
+  }
+};
+
+// Raccoon Public Key, prepared for verifying many signatures, same as `prepared_pkey_t`, except that public matrix A is borrowed from a shared memory
+// matrix cache, instead of being expanded and owned by each process. It keeps `t << 𝜈t`, in its NTT representation, and digest of the public key resident.
+template<size_t 𝜅, size_t k, size_t l, size_t 𝜈t>
+struct shm_prepared_pkey_t
+{
+private:
+  using cache_t = shm_matrix_cache_t<𝜅, k, l>;
+
+  raccoon_pkey::pkey_t<𝜅, k, 𝜈t> pkey{};
+  typename cache_t::matrix_ref_t A{};
+  raccoon_poly_vec::poly_vec_t<k, 1> t{};
+  std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> pk_digest{};
+
+public:
+  // Constructor(s)
+  shm_prepared_pkey_t(const cache_t& cache, const raccoon_pkey::pkey_t<𝜅, k, 𝜈t>& pkey)
+    : pkey(pkey)
+    , A(cache.get(pkey.get_seed()))
+  {
+    this->t = pkey.get_scaled_t_ntt();
+    pkey.hash(this->pk_digest);
+  }
+
+  // Accessor(s)
+  const raccoon_pkey::pkey_t<𝜅, k, 𝜈t>& get_pkey() const { return this->pkey; }
+  bool is_shared() const { return this->A.is_shared(); }
+
+  // Verifies a (message, signature) pair, returning boolean truth value in case of success, which is same as `pkey_t::verify`, minus the key dependent setup.
+  template<size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22, raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
+  bool verify(std::span<const uint8_t> msg, std::span<const uint8_t, sig_byte_len> sig) const
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
+    raccoon_poly_vec::poly_vec_t<k, 1> h{};
+    raccoon_poly_vec::poly_vec_t<l, 1> z{};
+
+    if (!raccoon_pkey::pkey_t<𝜅, k, 𝜈t>::template decode_and_check<l, 𝜈w, sig_byte_len, Binf, B22, timing_t>(sig, c_hash, h, z)) {
+      return false;
+    }
+
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    raccoon_challenge::msg_hash<𝜅>(this->pk_digest, msg, 𝜇);
+
+    return raccoon_pkey::pkey_t<𝜅, k, 𝜈t>::template verify_with<l, 𝜈w, 𝜔, timing_t>(this->A.get_A(), this->t, 𝜇, c_hash, h, z);
+  }
+};
+
+}
@@ -4,11 +4,235 @@
 #include "raccoon/internals/polynomial/poly_vec.hpp"
 #include "raccoon/internals/utility/serialization.hpp"
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <cstdlib>
 #include <optional>
 
 namespace raccoon_sig {
 
+// Outcome of pre-checking signature components, before serializing them, in order of the checks performed by signing algorithm.
+enum class precheck_t : uint8_t
+{
+  ok,            // Signature can be encoded in fixed space and passes norms check
+  too_long,      // Signature can't be encoded in fixed space `sig_byte_len`
+  out_of_bounds, // Signature can be encoded, but fails norms check
+};
+
+// Process-wide counters of signing attempts and of the reasons for rejecting them, updated with relaxed atomic increments. Counting is opt-in, as many
+// concurrent signers would otherwise contend on these counters, on every signing attempt. When disabled, which is the default, recording an attempt is a
+// single load of a flag, which is only ever written by `enable`. Each counter sits on its own cache line, so that signers don't falsely share them.
+struct rejection_counters_t
+{
+  alignas(64) std::atomic<bool> enabled{ false };
+  alignas(64) std::atomic<uint64_t> attempts{ 0 };
+  alignas(64) std::atomic<uint64_t> too_long{ 0 };
+  alignas(64) std::atomic<uint64_t> out_of_bounds{ 0 };
+
+  // Turns counting on or off, for signing attempts made afterwards.
+  void enable(const bool on) { this->enabled.store(on, std::memory_order_relaxed); }
+
+  void record(const precheck_t outcome)
+  {
+    if (!this->enabled.load(std::memory_order_relaxed)) {
+      return;
+    }
+
+    this->attempts.fetch_add(1, std::memory_order_relaxed);
+
+    if (outcome == precheck_t::too_long) {
+      this->too_long.fetch_add(1, std::memory_order_relaxed);
+    } else if (outcome == precheck_t::out_of_bounds) {
+      this->out_of_bounds.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  void reset()
+  {
+    this->attempts.store(0, std::memory_order_relaxed);
+    this->too_long.store(0, std::memory_order_relaxed);
+    this->out_of_bounds.store(0, std::memory_order_relaxed);
+  }
+};
+
+inline rejection_counters_t rejection_counters{};
+
+// Given hint vector `h` ∈ [0, q >> 𝜈w) and response vector `z` ∈ [0, q), computes byte length of the encoded signature ( see section 2.5.1 of the
+// specification ) and infinity/ L2 norms of the signature ( see algorithm 4 of the specification ), in a single pass over centered coefficients, without
+// serializing anything. Result is same as that of encoding the signature, using `sig_t::to_bytes`, followed by `sig_t::check_bounds`, on success of the
+// former, so that signing attempts destined to be rejected can be dropped early.
+template<size_t 𝜅, size_t k, size_t l, size_t 𝜈w, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+constexpr precheck_t
+precheck(const raccoon_poly_vec::poly_vec_t<k, 1>& h, const raccoon_poly_vec::poly_vec_t<l, 1>& z)
+{
+  constexpr uint64_t Q_prime = field::Q >> 𝜈w;
+
+  uint64_t bit_len = 0;
+  uint64_t h_inf_norm = 0;
+  uint64_t h_sqr_norm = 0;
+  uint64_t z_inf_norm = 0;
+  uint64_t z_sqr_norm = 0;
+
+  for (size_t ridx = 0; ridx < h.num_rows(); ridx++) {
+    const auto centered = h[ridx][0].template center<Q_prime>();
+
+#if defined __clang__
+#pragma clang loop vectorize(enable) interleave(enable)
+#endif
+    for (size_t i = 0; i < centered.size(); i++) {
+      const auto abs_x = static_cast<uint64_t>(std::abs(centered[i]));
+
+      // Unary encoding of |x|, followed by sign bit, if x != 0
+      bit_len += abs_x + 2 - static_cast<uint64_t>(abs_x == 0);
+      h_inf_norm = std::max(h_inf_norm, abs_x);
+      h_sqr_norm += abs_x * abs_x;
+    }
+  }
+
+  for (size_t ridx = 0; ridx < z.num_rows(); ridx++) {
+    const auto centered = z[ridx][0].template center<field::Q>();
+
+#if defined __clang__
+#pragma clang loop vectorize(enable) interleave(enable)
+#endif
+    for (size_t i = 0; i < centered.size(); i++) {
+      const auto abs_x = static_cast<uint64_t>(std::abs(centered[i]));
+
+      // Low 40 -bits of |x|, followed by unary encoding of remaining high bits of |x| and sign bit, if x != 0
+      bit_len += 40 + (abs_x >> 40) + 2 - static_cast<uint64_t>(abs_x == 0);
+      z_inf_norm = std::max(z_inf_norm, abs_x);
+
+      const auto abs_x_shft = abs_x >> 32;
+      z_sqr_norm += abs_x_shft * abs_x_shft;
+    }
+  }
+
+  constexpr size_t c_hash_byte_len = (2 * 𝜅) / std::numeric_limits<uint8_t>::digits;
+  const size_t encoded_byte_len = c_hash_byte_len + (bit_len + 7) / std::numeric_limits<uint8_t>::digits;
+  if (encoded_byte_len > sig_byte_len) {
+    return precheck_t::too_long;
+  }
+
+  if (h_inf_norm > (Binf >> 𝜈w)) {
+    return precheck_t::out_of_bounds;
+  }
+  if (z_inf_norm > Binf) {
+    return precheck_t::out_of_bounds;
+  }
+
+  static_assert((2 * 𝜈w) >= 64, "𝜈w must be >= 32");
+  const auto scaled_h_sqr_norm = h_sqr_norm * (1ul << ((2 * 𝜈w) - 64));
+
+  if ((scaled_h_sqr_norm + z_sqr_norm) > B22) {
+    return precheck_t::out_of_bounds;
+  }
+
+  return precheck_t::ok;
+}
+
+// Norms of hint vector `h` and response vector `z`, accumulated over their centered coefficients s.t. squared L2 norm of `z` is accumulated over
+// coefficients, shifted rightwards by 32 -bits, following algorithm 4 of the specification.
+struct sig_norms_t
+{
+  uint64_t h_inf_norm = 0;
+  uint64_t h_sqr_norm = 0;
+  uint64_t z_inf_norm = 0;
+  uint64_t z_sqr_norm = 0;
+
+  // Checks norms against their bounds, bounding infinity norms first, so that L2 norms can't have overflown, when they are compared.
+  template<size_t 𝜈w, uint64_t Binf, uint64_t B22>
+  constexpr bool within_bounds() const
+  {
+    if (this->h_inf_norm > (Binf >> 𝜈w)) {
+      return false;
+    }
+    if (this->z_inf_norm > Binf) {
+      return false;
+    }
+
+    static_assert((2 * 𝜈w) >= 64, "𝜈w must be >= 32");
+    const auto scaled_h_sqr_norm = this->h_sqr_norm * (1ul << ((2 * 𝜈w) - 64));
+
+    return (scaled_h_sqr_norm + this->z_sqr_norm) <= B22;
+  }
+};
+
+// Decodes a byte serialized signature straight into challenge hash, hint vector `h` ∈ [0, q >> 𝜈w) and response vector `z` ∈ [0, q), lifting centered
+// coefficients into their unsigned form as they get decoded, without staging them in a `sig_t`, while accumulating their norms. Returns true, only if
+// the signature can be decoded, following step 1 of algorithm 3 of the specification.
+//
+// Note, norms are computed over coefficients, as they are decoded, before being lifted, so that a coefficient, which is out of range, can never be
+// wrapped around into a small one. In variable-time mode, decoding stops as soon as a coefficient exceeds its infinity norm bound, returning false, in
+// which case accumulated norms are already out of bounds.
+template<size_t 𝜅, size_t k, size_t l, size_t 𝜈w, size_t sig_byte_len, uint64_t Binf, raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
+constexpr bool
+decode_with_norms(std::span<const uint8_t, sig_byte_len> bytes,
+                  std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash,
+                  raccoon_poly_vec::poly_vec_t<k, 1>& h,
+                  raccoon_poly_vec::poly_vec_t<l, 1>& z,
+                  sig_norms_t& norms)
+{
+  constexpr uint64_t Q_prime = field::Q >> 𝜈w;
+
+  const auto put_h = [&](const size_t idx, const int64_t x) {
+    const auto abs_x = (x < 0) ? -static_cast<uint64_t>(x) : static_cast<uint64_t>(x);
+    norms.h_inf_norm = std::max(norms.h_inf_norm, abs_x);
+    norms.h_sqr_norm += abs_x * abs_x;
+
+    const auto mask = static_cast<uint64_t>(x >> 63);
+    h[idx / raccoon_poly::N][0][idx % raccoon_poly::N] = static_cast<uint64_t>(x + static_cast<int64_t>(mask & Q_prime));
+
+    if constexpr (raccoon_timing::is_variable_time<timing_t>) {
+      return abs_x <= (Binf >> 𝜈w);
+    }
+  };
+
+  const auto put_z = [&](const size_t idx, const int64_t x) {
+    const auto abs_x = (x < 0) ? -static_cast<uint64_t>(x) : static_cast<uint64_t>(x);
+    norms.z_inf_norm = std::max(norms.z_inf_norm, abs_x);
+
+    const auto abs_x_shft = abs_x >> 32;
+    norms.z_sqr_norm += abs_x_shft * abs_x_shft;
+
+    const auto mask = static_cast<uint64_t>(x >> 63);
+    z[idx / raccoon_poly::N][0][idx % raccoon_poly::N] = static_cast<uint64_t>(x + static_cast<int64_t>(mask & field::Q));
+
+    if constexpr (raccoon_timing::is_variable_time<timing_t>) {
+      return abs_x <= Binf;
+    }
+  };
+
+  return raccoon_serialization::decode_sig_with<𝜅, k, l>(bytes, c_hash, put_h, put_z);
+}
+
+// Decodes a byte serialized signature straight into its components, same as `decode_with_norms`, and performs norms check ( see algorithm 4 of the
+// specification ) on them. Returns true, only if the signature can be decoded and it passes norms check, following step 1, 2 of algorithm 3 of the
+// specification.
+template<size_t 𝜅,
+         size_t k,
+         size_t l,
+         size_t 𝜈w,
+         size_t sig_byte_len,
+         uint64_t Binf,
+         uint64_t B22,
+         raccoon_timing::timing_c timing_t = raccoon_timing::constant_time_t>
+constexpr bool
+decode_and_check(std::span<const uint8_t, sig_byte_len> bytes,
+                 std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash,
+                 raccoon_poly_vec::poly_vec_t<k, 1>& h,
+                 raccoon_poly_vec::poly_vec_t<l, 1>& z)
+{
+  sig_norms_t norms{};
+
+  // Step 1: Attempt to decode signature into its components
+  if (!decode_with_norms<𝜅, k, l, 𝜈w, sig_byte_len, Binf, timing_t>(bytes, c_hash, h, z, norms)) {
+    return false;
+  }
+
+  // Step 2: Perform norms check
+  return norms.template within_bounds<𝜈w, Binf, B22>();
+}
+
 // Raccoon Signature, with fixed byte length
 template<size_t 𝜅, size_t k, size_t l, size_t 𝜈w, size_t sig_byte_len>
 struct sig_t
@@ -0,0 +1,86 @@
+#pragma once
+#include "public_key.hpp"
+#include "raccoon/internals/polynomial/challenge.hpp"
+#include "secret_key.hpp"
+#include <future>
+
+// Incremental (init/ update/ final) signing and verification, for messages which don't fit in memory
+namespace raccoon_stream {
+
+// Signs a message, which is absorbed in arbitrary many chunks, using a prepared secret key, which must outlive the signer.
+//
+// Message independent commitment ( steps 4-9 of algorithm 2 of the specification ) of the first signing attempt is computed on a background thread,
+// started at construction, while the caller keeps streaming the message in. `final_sign` waits for it and only computes the response, unless the first
+// attempt gets rejected. A signer produces exactly one signature, hence it must not be updated or finalized, once finalized.
+template<size_t 𝜅, size_t k, size_t l, size_t d, size_t 𝜈t, size_t 𝑢w, size_t 𝜈w, size_t rep>
+struct signer_t
+{
+private:
+  using prepared_skey_t = raccoon_skey::prepared_skey_t<𝜅, k, l, d, 𝜈t>;
+  using presig_ptr_t = typename raccoon_presig::presig_pool_t<𝜅, k, l, d>::presig_ptr_t;
+
+  const prepared_skey_t& psk;
+  raccoon_challenge::msg_hasher_t<𝜅> hasher{};
+  std::future<presig_ptr_t> presig{};
+
+public:
+  // Constructor(s)
+  explicit signer_t(const prepared_skey_t& psk)
+    : psk(psk)
+    , hasher(psk.get_pk_digest())
+    , presig(std::async(std::launch::async, [&psk] { return psk.template presign<𝑢w, 𝜈w, rep>(); }))
+  {
+  }
+
+  signer_t(const signer_t&) = delete;
+  signer_t& operator=(const signer_t&) = delete;
+
+  // Absorbs next chunk of the message to be signed.
+  void update(std::span<const uint8_t> msg_chunk) { this->hasher.update(msg_chunk); }
+
+  // Finishes absorbing the message and signs it, producing a byte serialized signature.
+  template<size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  void final_sign(std::span<uint8_t, sig_byte_len> sig_bytes)
+    requires(raccoon_params::validate_sign_args(𝜅, k, l, d, 𝑢w, 𝜈w, 𝜈t, rep, 𝜔, sig_byte_len, Binf, B22))
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    this->hasher.finalize(𝜇);
+
+    this->psk.template sign_digest<𝑢w, 𝜈w, rep, 𝜔, sig_byte_len, Binf, B22>(𝜇, sig_bytes, this->presig.get());
+  }
+};
+
+// Verifies a signature over a message, which is absorbed in arbitrary many chunks, using a prepared public key, which must outlive the verifier. Result
+// of verification is same as that of one-shot verification, over the concatenation of all chunks. Must not be updated or finalized, once finalized.
+template<size_t 𝜅, size_t k, size_t l, size_t 𝜈t>
+struct verifier_t
+{
+private:
+  using prepared_pkey_t = raccoon_pkey::prepared_pkey_t<𝜅, k, l, 𝜈t>;
+
+  const prepared_pkey_t& ppk;
+  raccoon_challenge::msg_hasher_t<𝜅> hasher{};
+
+public:
+  // Constructor(s)
+  explicit constexpr verifier_t(const prepared_pkey_t& ppk)
+    : ppk(ppk)
+    , hasher(ppk.get_pk_digest())
+  {
+  }
+
+  // Absorbs next chunk of the message, whose signature is to be verified.
+  constexpr void update(std::span<const uint8_t> msg_chunk) { this->hasher.update(msg_chunk); }
+
+  // Finishes absorbing the message and verifies the signature, returning boolean truth value in case of success.
+  template<size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+  constexpr bool final_verify(std::span<const uint8_t, sig_byte_len> sig)
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    this->hasher.finalize(𝜇);
+
+    return this->ppk.template verify_digest<𝜈w, 𝜔, sig_byte_len, Binf, B22>(𝜇, sig);
+  }
+};
+
+}
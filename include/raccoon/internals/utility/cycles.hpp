@@ -0,0 +1,29 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+#if defined __x86_64__
+#include <x86intrin.h>
+#endif
+
+// Cheap reading of CPU cycle counter, for attributing cost to individual stages of an operation
+namespace raccoon_cycles {
+
+// Returns current value of CPU's cycle counter i.e. time-stamp counter on x86_64 and virtual counter on aarch64. On other targets, it falls back to
+// nanoseconds elapsed on a steady clock. Only difference between two readings, taken on the same thread, is meaningful.
+inline uint64_t
+now()
+{
+#if defined __x86_64__
+  return __rdtsc();
+#elif defined __aarch64__
+  uint64_t ticks = 0;
+  asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+  return ticks;
+#else
+  const auto elapsed = std::chrono::steady_clock::now().time_since_epoch();
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+#endif
+}
+
+}
@@ -3,7 +3,10 @@
 #include "raccoon/internals/rng/prng.hpp"
 #include "raccoon/internals/utility/utils.hpp"
 #include <algorithm>
+#include <bit>
+#include <cstring>
 #include <limits>
+#include <type_traits>
 
 namespace raccoon_serialization {
 
@@ -339,202 +342,193 @@ encode_sig(std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::d
   return encodable;
 }
 
-// Extracts n -th bit from 64 -bit word s.t. n < 64.
-forceinline constexpr uint64_t
-get_bit_at(const uint64_t word, const size_t idx)
+// Little-endian bit reader over a byte array, which keeps not yet consumed bits in a 64 -bit word. As long as the input has at least 8 -bytes left, the word
+// is refilled by a single 8 -byte load, without branching on how many bits it still holds, s.t. it holds 56 to 63 valid bits, after a refill. Bits of the
+// word, above the valid ones, are either zero or same as the upcoming bits of the input, hence they must only be trusted, after checking `num_bits()`.
+struct bit_reader_t
 {
-  return (word >> idx) & 0b1ul;
-}
-
-// Given a 64 -bit buffer s.t. `buf_bit_off` bits, from LSB side, are part of current active buffer, this routine tries to decode
-// a small signed integer (which is a coefficient of the hint vector `h`), from those bits, while also returning how many bits were
-// consumed during decoding.
-forceinline constexpr std::pair<int64_t, size_t>
-decode_bits_as_hint_coeff(const uint64_t buffer, const size_t buf_bit_off)
-{
-  int64_t res = 0;
-  size_t bit_idx = 0;
+private:
+  std::span<const uint8_t> bytes{};
+  size_t byte_off = 0;
+  uint64_t buffer = 0;
+  size_t buf_bit_cnt = 0;
 
-  while ((bit_idx < buf_bit_off) && get_bit_at(buffer, bit_idx) == 1) {
-    res++;
-    bit_idx++;
-  }
+public:
+  // Longest run of ones, an unary encoded integer can be made of, s.t. the run, its terminating zero and a sign bit always fit in a refilled word.
+  static constexpr size_t MAX_UNARY_RUN = 54;
 
-  // exhaused all available bits
-  if (bit_idx == buf_bit_off) {
-    return { 0, 0 };
+  // Constructor(s)
+  explicit constexpr bit_reader_t(std::span<const uint8_t> bytes)
+    : bytes(bytes)
+  {
   }
 
-  // skip the stop bit
-  bit_idx++;
+  // Not yet consumed bits, starting from LSB. Only lowest `num_bits()` -many of them are valid.
+  forceinline constexpr uint64_t bits() const { return this->buffer; }
+  forceinline constexpr size_t num_bits() const { return this->buf_bit_cnt; }
+
+  // Tops up the word with as many whole bytes as it can hold, s.t. it holds at least 56 valid bits, unless the input is exhausted.
+  forceinline constexpr void refill()
+  {
+    if ((this->bytes.size() - this->byte_off) >= sizeof(uint64_t)) [[likely]] {
+      uint64_t word = 0;
+      if (std::is_constant_evaluated()) {
+        word = raccoon_utils::from_le_bytes<uint64_t>(this->bytes.subspan(this->byte_off, sizeof(word)));
+      } else {
+        // Single, unaligned little-endian load, which is what `from_le_bytes` computes, on little-endian targets
+        std::memcpy(&word, this->bytes.data() + this->byte_off, sizeof(word));
+      }
 
-  // figure out the sign bit
-  if (res > 0) {
-    if (get_bit_at(buffer, bit_idx) == 1) {
-      res = -res;
+      this->buffer |= word << this->buf_bit_cnt;
+      this->byte_off += (std::numeric_limits<uint64_t>::digits - 1 - this->buf_bit_cnt) / std::numeric_limits<uint8_t>::digits;
+      this->buf_bit_cnt |= 56;
+      return;
     }
-    bit_idx++;
-  }
 
-  return { res, bit_idx };
-}
-
-// Given a 64 -bit buffer s.t. `buf_bit_off` bits, from LSB side, are part of the current active buffer area and a 40 -bit unsigned
-// integer `a` (i.e. low 40 -bits of the resulting coefficient), this routine tries to decode a small signed integer (which forms the
-// high bits of a coefficient of the response vector `z`), from those bits, while returning a signed integer which is ~40 -bits and
-// how many bits were consumed for decoding the high part of the coefficient.
-forceinline constexpr std::pair<int64_t, size_t>
-decode_bits_as_response_coeff(const uint64_t buffer, const size_t buf_bit_off, const int64_t a)
-{
-  int64_t b = 0;
-  size_t bit_idx = 0;
-
-  while ((bit_idx < buf_bit_off) && (get_bit_at(buffer, bit_idx) == 1)) {
-    b++;
-    bit_idx++;
+    while ((this->buf_bit_cnt < 56) && (this->byte_off < this->bytes.size())) {
+      this->buffer |= static_cast<uint64_t>(this->bytes[this->byte_off]) << this->buf_bit_cnt;
+      this->byte_off++;
+      this->buf_bit_cnt += std::numeric_limits<uint8_t>::digits;
+    }
   }
 
-  // exhausted all available bits in the buffer
-  if (bit_idx == buf_bit_off) {
-    return { a, 0 };
+  // Consumes n (<= `num_bits()`) -many lowest bits of the word.
+  forceinline constexpr void consume(const size_t n)
+  {
+    this->buffer >>= n;
+    this->buf_bit_cnt -= n;
   }
 
-  // skip the stop bit
-  bit_idx++;
+  // Checks whether all the bits, which are not yet consumed, are zero.
+  constexpr bool is_zero_padded() const
+  {
+    const uint64_t mask = (1ul << this->buf_bit_cnt) - 1;
 
-  // figure out if there is any sign bit that needs to be read
-  int64_t res = (b << 40) | a;
-  if (res > 0) {
-    if (get_bit_at(buffer, bit_idx) == 1) {
-      res = -res;
+    uint8_t acc = 0;
+    for (auto byte : this->bytes.subspan(this->byte_off)) {
+      acc |= byte;
     }
-    bit_idx++;
+
+    return ((this->buffer & mask) == 0) && (acc == 0);
   }
+};
 
-  return { res, bit_idx };
+// Hands over a decoded coefficient to the caller supplied callback, which either returns nothing or returns false, for stopping decoding early.
+template<typename put_t>
+forceinline constexpr bool
+put_coeff(put_t& put, const size_t idx, const int64_t coeff)
+{
+  if constexpr (std::is_void_v<std::invoke_result_t<put_t&, size_t, int64_t>>) {
+    put(idx, coeff);
+    return true;
+  } else {
+    return put(idx, coeff);
+  }
 }
 
-// Decodes a byte encoded signature as (c_hash, h, z), following section 2.5.1 of the Raccoon specification.
+// Decodes a byte encoded signature as (c_hash, h, z), following section 2.5.1 of the Raccoon specification, s.t. each decoded coefficient of `h` and `z`
+// is handed over to `put_h(idx, coeff)` and `put_z(idx, coeff)` respectively, as soon as it's decoded, letting the caller decide where and in which form
+// it gets stored. A callback may also return a boolean, s.t. returning false fails decoding right away.
+//
+// Each unary encoded run is read at once, by counting trailing ones of the bit reader's word. Only canonical encodings are accepted i.e. signature must
+// hold all coefficients of `h` and `z`, followed by only zero bits. A negative zero can't be encoded, as sign bit is only present for non-zero coefficients.
+// Coefficients, whose unary encoded part is a run of more than `bit_reader_t::MAX_UNARY_RUN` ones, are rejected too, as none of them can ever pass norms
+// check of any parameter set.
 //
 // In case signature decoding fails, it returns false, else it returns true.
-template<size_t 𝜅, size_t k, size_t l, size_t sig_byte_len>
+template<size_t 𝜅, size_t k, size_t l, size_t sig_byte_len, typename put_h_t, typename put_z_t>
 constexpr bool
-decode_sig(std::span<const uint8_t, sig_byte_len> sig,
-           std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash,
-           std::span<int64_t, k * raccoon_poly::N> h,
-           std::span<int64_t, l * raccoon_poly::N> z)
+decode_sig_with(std::span<const uint8_t, sig_byte_len> sig,
+                std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash,
+                put_h_t&& put_h,
+                put_z_t&& put_z)
 {
-  bool decodable = true;
-  size_t sig_off = 0;
+  constexpr size_t h_num_coeffs = k * raccoon_poly::N;
+  constexpr size_t z_num_coeffs = l * raccoon_poly::N;
+  constexpr uint64_t mask40 = (1ul << 40) - 1;
 
   std::copy_n(sig.begin(), c_hash.size(), c_hash.begin());
-  sig_off += c_hash.size();
+  bit_reader_t reader(sig.subspan(c_hash.size()));
 
-  uint64_t buffer = 0;
-  size_t buf_bit_off = 0;
-
-  size_t h_coeff_idx = 0;
-  while ((sig_off < sig_byte_len) && (h_coeff_idx < h.size())) {
-    const size_t bufferable_num_bits = std::numeric_limits<uint64_t>::digits - buf_bit_off;
-    const size_t readable_num_bits = bufferable_num_bits & (-8ul);
-    const size_t readable_num_bytes = readable_num_bits / std::numeric_limits<uint8_t>::digits;
-    const size_t to_be_buffered_num_bytes = std::min(readable_num_bytes, sig_byte_len - sig_off);
-
-    const auto word = raccoon_utils::from_le_bytes<uint64_t>(sig.subspan(sig_off, to_be_buffered_num_bytes));
-    buffer |= (word << buf_bit_off);
-    buf_bit_off += (to_be_buffered_num_bytes * std::numeric_limits<uint8_t>::digits);
-
-    int64_t coeff = 0;
-    size_t bits_consumed = 0;
-    std::tie(coeff, bits_consumed) = decode_bits_as_hint_coeff(buffer, buf_bit_off);
-
-    if (bits_consumed > 0) [[likely]] {
-      h[h_coeff_idx] = coeff;
-      h_coeff_idx++;
-
-      buf_bit_off -= bits_consumed;
-      buffer >>= bits_consumed;
-    } else {
-      decodable = false;
-      break;
-    }
+  for (size_t h_coeff_idx = 0; h_coeff_idx < h_num_coeffs; h_coeff_idx++) {
+    reader.refill();
 
-    sig_off += to_be_buffered_num_bytes;
-  }
+    const uint64_t bits = reader.bits();
+    const auto run = static_cast<size_t>(std::countr_one(bits));
 
-  if (!decodable) {
-    return decodable;
-  }
+    // unary encoded magnitude, the stop bit and the sign bit, only if magnitude is non-zero
+    const size_t sign_bit_cnt = run > 0;
+    const size_t coeff_bit_cnt = run + 1 + sign_bit_cnt;
 
-  if ((sig_off == sig_byte_len) || (h_coeff_idx != h.size())) {
-    decodable = false;
-    return decodable;
-  }
+    if ((run > bit_reader_t::MAX_UNARY_RUN) || (coeff_bit_cnt > reader.num_bits())) [[unlikely]] {
+      return false;
+    }
 
-  size_t z_coeff_idx = 0;
-  while ((sig_off < sig_byte_len) && (z_coeff_idx < z.size())) {
-    const size_t bufferable_num_bits = std::numeric_limits<uint64_t>::digits - buf_bit_off;
-    const size_t readable_num_bits = bufferable_num_bits & (-8ul);
-    const size_t readable_num_bytes = readable_num_bits / std::numeric_limits<uint8_t>::digits;
-    const size_t to_be_buffered_num_bytes = std::min(readable_num_bytes, sig_byte_len - sig_off);
+    const auto magnitude = static_cast<int64_t>(run);
+    const bool is_negative = ((bits >> (run + 1)) & sign_bit_cnt) == 1;
 
-    const auto word = raccoon_utils::from_le_bytes<uint64_t>(sig.subspan(sig_off, to_be_buffered_num_bytes));
-    buffer |= (word << buf_bit_off);
-    buf_bit_off += (to_be_buffered_num_bytes * std::numeric_limits<uint8_t>::digits);
+    if (!put_coeff(put_h, h_coeff_idx, is_negative ? -magnitude : magnitude)) {
+      return false;
+    }
+    reader.consume(coeff_bit_cnt);
+  }
 
-    if (buf_bit_off > 40) [[likely]] {
-      constexpr uint64_t mask40 = (1ul << 40) - 1;
-      const auto a = static_cast<int64_t>(buffer & mask40);
+  for (size_t z_coeff_idx = 0; z_coeff_idx < z_num_coeffs; z_coeff_idx++) {
+    reader.refill();
+    if (reader.num_bits() < 40) [[unlikely]] {
+      return false;
+    }
 
-      buffer >>= 40;
-      buf_bit_off -= 40;
+    const uint64_t a = reader.bits() & mask40;
+    reader.consume(40);
 
-      int64_t coeff = 0;
-      size_t bits_consumed = 0;
-      std::tie(coeff, bits_consumed) = decode_bits_as_response_coeff(buffer, buf_bit_off, a);
+    uint64_t bits = reader.bits();
+    auto run = static_cast<size_t>(std::countr_one(bits));
 
-      if (bits_consumed > 0) [[likely]] {
-        z[z_coeff_idx] = coeff;
-        z_coeff_idx++;
+    // high part may not fit in what's left of the word, after reading low 40 -bits
+    if ((run + 2) > reader.num_bits()) [[unlikely]] {
+      reader.refill();
 
-        buf_bit_off -= bits_consumed;
-        buffer >>= bits_consumed;
-      } else {
-        decodable = false;
-        break;
-      }
+      bits = reader.bits();
+      run = static_cast<size_t>(std::countr_one(bits));
     }
 
-    sig_off += to_be_buffered_num_bytes;
-  }
-
-  if (!decodable) {
-    return decodable;
-  }
+    if (run > bit_reader_t::MAX_UNARY_RUN) [[unlikely]] {
+      return false;
+    }
 
-  if (z_coeff_idx != z.size()) {
-    decodable = false;
-    return decodable;
-  }
+    const uint64_t magnitude = (static_cast<uint64_t>(run) << 40) | a;
+    const size_t sign_bit_cnt = magnitude > 0;
+    const size_t coeff_bit_cnt = run + 1 + sign_bit_cnt;
 
-  if (buf_bit_off > 0) {
-    const uint64_t mask = (1ul << buf_bit_off) - 1;
-    decodable = ((buffer & mask) == 0);
+    if (coeff_bit_cnt > reader.num_bits()) [[unlikely]] {
+      return false;
+    }
 
-    buffer >>= buf_bit_off;
-    buf_bit_off = 0;
-  }
+    const bool is_negative = ((bits >> (run + 1)) & sign_bit_cnt) == 1;
 
-  if (!decodable) {
-    return decodable;
+    if (!put_coeff(put_z, z_coeff_idx, is_negative ? -static_cast<int64_t>(magnitude) : static_cast<int64_t>(magnitude))) {
+      return false;
+    }
+    reader.consume(coeff_bit_cnt);
   }
 
-  auto remaining_sig = sig.subspan(sig_off, sig_byte_len - sig_off);
-  for (auto byte : remaining_sig) {
-    decodable &= (byte == 0);
-  }
+  return reader.is_zero_padded();
+}
 
-  return decodable;
+// Decodes a byte encoded signature as (c_hash, h, z), following section 2.5.1 of the Raccoon specification, s.t. `h` and `z` are written as centered
+// coefficients.
+//
+// In case signature decoding fails, it returns false, else it returns true.
+template<size_t 𝜅, size_t k, size_t l, size_t sig_byte_len>
+constexpr bool
+decode_sig(std::span<const uint8_t, sig_byte_len> sig,
+           std::span<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash,
+           std::span<int64_t, k * raccoon_poly::N> h,
+           std::span<int64_t, l * raccoon_poly::N> z)
+{
+  return decode_sig_with<𝜅, k, l>(
+    sig, c_hash, [&](const size_t idx, const int64_t coeff) { h[idx] = coeff; }, [&](const size_t idx, const int64_t coeff) { z[idx] = coeff; });
 }
 
 }
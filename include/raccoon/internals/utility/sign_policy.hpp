@@ -0,0 +1,34 @@
+#pragma once
+#include "raccoon/internals/utility/thread_pool.hpp"
+#include <chrono>
+#include <cstddef>
+
+// Policies, controlling how signing attempts are scheduled
+namespace raccoon_sign_policy {
+
+// Signing attempts are made one after another, on the calling thread, until one of them succeeds. This is the default.
+struct sequential_t
+{};
+
+// `num_attempts` (>0) -many independent signing attempts are run speculatively, in parallel, s.t. one of them runs on the calling thread, while others
+// are submitted to the thread pool. Each attempt uses its own copy of the masked secret key and its own randomness. As soon as one of them produces a
+// valid signature, others are cooperatively cancelled and whatever they computed is discarded.
+//
+// Note, signing call blocks until all submitted attempts have returned. When it's made from a worker thread of the same pool, attempts run on the calling
+// thread instead, as waiting on a saturated pool from one of its own workers would deadlock.
+struct speculative_t
+{
+  raccoon_thread_pool::thread_pool_t& pool;
+  size_t num_attempts = 1;
+};
+
+// Cadence of refreshing shares of the masked secret key in the background, while it keeps serving concurrent signers. Shares are refreshed once every
+// `num_sigs` -many signatures and once every `interval` of time, whichever comes first. Zero disables the corresponding trigger, but at least one of them
+// must stay enabled.
+struct refresh_cadence_t
+{
+  size_t num_sigs = 128;
+  std::chrono::milliseconds interval{ 100 };
+};
+
+}
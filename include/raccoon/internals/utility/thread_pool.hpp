@@ -0,0 +1,140 @@
+#pragma once
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <pthread.h>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Fixed size pool of worker threads, executing submitted tasks in FIFO order
+namespace raccoon_thread_pool {
+
+// Speculative and batch signing keep masked polynomial vectors of their attempts on heap, while asynchronous signing still keeps some of them on stack,
+// needing ~2 MB for Raccoon-256 with 32 shares. That overflows default stack size of worker threads on some platforms, hence workers are spawned with
+// explicitly requested stack size, matching the usual stack size of the main thread, which leaves some room to spare.
+constexpr size_t DEFAULT_STACK_BYTE_LEN = 8ul << 20;
+
+// Counts down the latch, when going out of scope, so that a task submitted to the pool counts down, even if it throws, and the thread waiting on the
+// latch never waits forever.
+struct count_down_guard_t
+{
+  std::latch& finished;
+  ~count_down_guard_t() { finished.count_down(); }
+};
+
+struct thread_pool_t
+{
+private:
+  std::mutex lock{};
+  std::condition_variable_any has_task{};
+  std::deque<std::function<void()>> tasks{};
+  std::stop_source stop{};
+  std::vector<pthread_t> workers{};
+
+  // Pool, whose worker is the current thread, if any.
+  inline static thread_local const thread_pool_t* current = nullptr;
+
+  // Each worker keeps executing tasks, until stop is requested and there are no more pending tasks.
+  void work(std::stop_token stoken)
+  {
+    while (true) {
+      std::function<void()> task{};
+
+      {
+        std::unique_lock guard(this->lock);
+        this->has_task.wait(guard, stoken, [this] { return !this->tasks.empty(); });
+
+        if (this->tasks.empty()) {
+          // Stop was requested and there's nothing left to be executed
+          return;
+        }
+
+        task = std::move(this->tasks.front());
+        this->tasks.pop_front();
+      }
+
+      task();
+    }
+  }
+
+  static void* worker_entry(void* arg)
+  {
+    auto pool = static_cast<thread_pool_t*>(arg);
+    current = pool;
+    pool->work(pool->stop.get_token());
+    return nullptr;
+  }
+
+  // Requests all workers to stop, after draining pending tasks, and joins them.
+  void shutdown()
+  {
+    this->stop.request_stop();
+    for (auto worker : this->workers) {
+      pthread_join(worker, nullptr);
+    }
+    this->workers.clear();
+  }
+
+public:
+  // Spawns `num_threads` (>0) -many worker threads, each with a stack of `stack_byte_len` -bytes. Defaults to number of concurrent threads supported by
+  // the hardware. Throws `std::runtime_error`, if worker threads can't be spawned.
+  explicit thread_pool_t(const size_t num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1),
+                         const size_t stack_byte_len = DEFAULT_STACK_BYTE_LEN)
+  {
+    pthread_attr_t attr{};
+    if (pthread_attr_init(&attr) != 0) {
+      throw std::runtime_error("failed to initialize worker thread attributes");
+    }
+    if (pthread_attr_setstacksize(&attr, stack_byte_len) != 0) {
+      pthread_attr_destroy(&attr);
+      throw std::runtime_error("failed to set worker thread stack size");
+    }
+
+    this->workers.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; i++) {
+      pthread_t worker{};
+      if (pthread_create(&worker, &attr, &thread_pool_t::worker_entry, this) != 0) {
+        pthread_attr_destroy(&attr);
+        this->shutdown();
+        throw std::runtime_error("failed to spawn worker thread");
+      }
+
+      this->workers.push_back(worker);
+    }
+
+    pthread_attr_destroy(&attr);
+  }
+
+  thread_pool_t(const thread_pool_t&) = delete;
+  thread_pool_t& operator=(const thread_pool_t&) = delete;
+
+  ~thread_pool_t() { this->shutdown(); }
+
+  // Number of worker threads in the pool.
+  size_t num_threads() const { return this->workers.size(); }
+
+  // Checks whether the calling thread is one of the worker threads of this pool. A task blocking on other tasks of the same pool can deadlock, once all
+  // workers are busy, hence such tasks must not wait on this pool.
+  bool is_worker_thread() const { return current == this; }
+
+  // Enqueues a task, to be executed by one of the worker threads.
+  template<typename F>
+  void submit(F&& task)
+  {
+    {
+      std::scoped_lock guard(this->lock);
+      this->tasks.emplace_back(std::forward<F>(task));
+    }
+
+    this->has_task.notify_one();
+  }
+};
+
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <concepts>
+
+// Tags, selecting whether a routine, which only ever handles public data, keeps using constant-time idioms or is allowed to take data dependent shortcuts
+namespace raccoon_timing {
+
+// Routine uses same constant-time idioms, as the code handling secret data. This is the default.
+struct constant_time_t
+{};
+
+// Routine may take data dependent early exits, branches and table lookups, along with short-circuiting comparisons. Must only be used with public inputs.
+struct variable_time_t
+{};
+
+template<typename T>
+concept timing_c = std::same_as<T, constant_time_t> || std::same_as<T, variable_time_t>;
+
+template<timing_c T>
+inline constexpr bool is_variable_time = std::same_as<T, variable_time_t>;
+
+}
@@ -0,0 +1,233 @@
+#pragma once
+#include "public_key.hpp"
+#include "shake256.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Bounded cache of successful verifications, short-circuiting repeated verification of the same (public key, message, signature) triple
+namespace raccoon_verify_cache {
+
+// Snapshot of the counters of a verification cache.
+struct cache_stats_t
+{
+  uint64_t hits = 0;      // Verifications answered from the cache
+  uint64_t misses = 0;    // Verifications, which had to be performed
+  uint64_t evictions = 0; // Least recently used entries, evicted to make room for new ones
+  uint64_t contended = 0; // Shard lock acquisitions, which found the lock already taken
+};
+
+// Sharded LRU cache of (public key, message, signature) triples, which are known to be valid. Only successful verifications are cached, so that a cache
+// hit always means the signature is valid, while a miss falls back to full verification.
+//
+// Each entry is keyed by `2 * 𝜅` -bit SHAKE256 digest of (𝜇, signature), where 𝜇 already binds the public key with the message, so that a triple can't
+// collide with another one, short of finding a SHAKE256 collision. Key's leading bytes pick the shard, each of which has its own lock and LRU order, so that
+// concurrent callers mostly touch different shards. Verification itself runs without holding any lock.
+template<size_t 𝜅, size_t k, size_t l, size_t 𝜈t, size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+struct verify_cache_t
+{
+public:
+  using pkey_t = raccoon_pkey::pkey_t<𝜅, k, 𝜈t>;
+  using prepared_pkey_t = raccoon_pkey::prepared_pkey_t<𝜅, k, l, 𝜈t>;
+
+  // Default number of shards.
+  static constexpr size_t NUM_SHARDS = 16;
+
+private:
+  using digest_t = std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits>;
+
+  // Key is already a uniformly random looking digest, hence its leading bytes are good enough as hash.
+  struct key_hash_t
+  {
+    size_t operator()(const digest_t& key) const
+    {
+      size_t hash = 0;
+      std::memcpy(&hash, key.data(), sizeof(hash));
+      return hash;
+    }
+  };
+
+  struct alignas(64) shard_t
+  {
+    std::mutex lock{};
+    std::list<digest_t> lru{};
+    std::unordered_map<digest_t, typename std::list<digest_t>::iterator, key_hash_t> index{};
+  };
+
+  std::vector<std::unique_ptr<shard_t>> shards{};
+  size_t shard_capacity = 0;
+
+  std::atomic<uint64_t> hits{ 0 };
+  std::atomic<uint64_t> misses{ 0 };
+  std::atomic<uint64_t> evictions{ 0 };
+  std::atomic<uint64_t> contended{ 0 };
+
+  static digest_t compute_key(std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇, std::span<const uint8_t, sig_byte_len> sig)
+  {
+    digest_t key{};
+
+    shake256::shake256_t hasher{};
+    hasher.absorb(𝜇);
+    hasher.absorb(sig);
+    hasher.finalize();
+    hasher.squeeze(key);
+
+    return key;
+  }
+
+  shard_t& shard_of(const digest_t& key)
+  {
+    // Skips bytes, which are already used for hashing the key, within the shard
+    return *this->shards[key[sizeof(size_t)] % this->shards.size()];
+  }
+
+  // Takes lock of the shard, counting the acquisition as contended, if the lock was already taken.
+  std::unique_lock<std::mutex> acquire(shard_t& shard)
+  {
+    std::unique_lock guard(shard.lock, std::try_to_lock);
+    if (!guard.owns_lock()) {
+      this->contended.fetch_add(1, std::memory_order_relaxed);
+      guard.lock();
+    }
+
+    return guard;
+  }
+
+  // Looks up the key, marking it as the most recently used one, on a hit.
+  bool lookup(const digest_t& key)
+  {
+    auto& shard = this->shard_of(key);
+    const auto guard = this->acquire(shard);
+
+    const auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+      this->misses.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    this->hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Inserts the key as the most recently used one, evicting the least recently used one, if the shard is full.
+  void insert(const digest_t& key)
+  {
+    auto& shard = this->shard_of(key);
+    const auto guard = this->acquire(shard);
+
+    // Some other caller may have verified the same triple, in the meantime
+    if (shard.index.contains(key)) {
+      return;
+    }
+
+    if (shard.lru.size() == this->shard_capacity) {
+      shard.index.erase(shard.lru.back());
+      shard.lru.pop_back();
+      this->evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    shard.lru.push_front(key);
+    shard.index.emplace(key, shard.lru.begin());
+  }
+
+  // Answers from the cache, if possible, else performs verification using `verify_digest(𝜇)` and caches its outcome, only if it's a success.
+  template<typename verify_t>
+  bool verify_with(std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇,
+                   std::span<const uint8_t, sig_byte_len> sig,
+                   verify_t&& verify_digest)
+  {
+    const auto key = compute_key(𝜇, sig);
+    if (this->lookup(key)) {
+      return true;
+    }
+
+    const bool is_verified = verify_digest(𝜇);
+    if (is_verified) {
+      this->insert(key);
+    }
+
+    return is_verified;
+  }
+
+public:
+  // Creates a cache, holding at most `capacity` (>0) -many entries, spread over `num_shards` (>0) -many shards, each holding an equal share of them.
+  explicit verify_cache_t(const size_t capacity, const size_t num_shards = NUM_SHARDS)
+  {
+    const size_t shard_cnt = std::max<size_t>(num_shards, 1);
+
+    this->shard_capacity = std::max<size_t>((capacity + shard_cnt - 1) / shard_cnt, 1);
+    this->shards.reserve(shard_cnt);
+    for (size_t i = 0; i < shard_cnt; i++) {
+      this->shards.push_back(std::make_unique<shard_t>());
+    }
+  }
+
+  verify_cache_t(const verify_cache_t&) = delete;
+  verify_cache_t& operator=(const verify_cache_t&) = delete;
+
+  // Verifies a (message, signature) pair under given public key, answering from the cache, if the same triple was already verified successfully. Outcome
+  // of verification is same as that of `pkey_t::verify`.
+  bool verify(const pkey_t& pkey, std::span<const uint8_t> msg, std::span<const uint8_t, sig_byte_len> sig)
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    pkey.hash(𝜇);
+    raccoon_challenge::msg_hash<𝜅>(𝜇, msg, 𝜇);
+
+    return this->verify_with(𝜇, sig, [&](std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇) {
+      return pkey.template verify_digest<l, 𝜈w, 𝜔, sig_byte_len, Binf, B22>(𝜇, sig);
+    });
+  }
+
+  // Same as above, but using a prepared public key, which also skips hashing of the public key.
+  bool verify(const prepared_pkey_t& ppk, std::span<const uint8_t> msg, std::span<const uint8_t, sig_byte_len> sig)
+  {
+    std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇{};
+    raccoon_challenge::msg_hash<𝜅>(ppk.get_pk_digest(), msg, 𝜇);
+
+    return this->verify_with(𝜇, sig, [&](std::span<const uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> 𝜇) {
+      return ppk.template verify_digest<𝜈w, 𝜔, sig_byte_len, Binf, B22>(𝜇, sig);
+    });
+  }
+
+  // Number of entries, currently held by the cache.
+  size_t size()
+  {
+    size_t cnt = 0;
+    for (auto& shard : this->shards) {
+      std::scoped_lock guard(shard->lock);
+      cnt += shard->lru.size();
+    }
+
+    return cnt;
+  }
+
+  // Maximum number of entries, the cache can hold.
+  size_t capacity() const { return this->shard_capacity * this->shards.size(); }
+
+  // Returns a snapshot of the counters, accumulated since creation of the cache or since last call to `reset_stats`.
+  cache_stats_t stats() const
+  {
+    return cache_stats_t{
+      .hits = this->hits.load(std::memory_order_relaxed),
+      .misses = this->misses.load(std::memory_order_relaxed),
+      .evictions = this->evictions.load(std::memory_order_relaxed),
+      .contended = this->contended.load(std::memory_order_relaxed),
+    };
+  }
+
+  void reset_stats()
+  {
+    this->hits.store(0, std::memory_order_relaxed);
+    this->misses.store(0, std::memory_order_relaxed);
+    this->evictions.store(0, std::memory_order_relaxed);
+    this->contended.store(0, std::memory_order_relaxed);
+  }
+};
+
+}
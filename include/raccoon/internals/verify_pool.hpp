@@ -0,0 +1,212 @@
+#pragma once
+#include "public_key.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Multi-threaded verification of (public key, message, signature) jobs, on a work-stealing pool of worker threads
+namespace raccoon_verify_pool {
+
+// Pool of worker threads, verifying jobs, each carrying its own public key, message and signature. Each worker owns a deque of jobs, which is fed by
+// submitters in round-robin order. A worker keeps taking jobs from the front of its own deque and, once it runs dry, steals from the back of others'.
+//
+// Each worker also keeps a small cache of prepared public keys ( see `prepared_pkey_t` ), keyed by the digest of the public key, so that jobs of a recently
+// seen public key skip expansion of public matrix A. Outcome of each job is same as that of `pkey_t::verify`.
+template<size_t 𝜅, size_t k, size_t l, size_t 𝜈t, size_t 𝜈w, size_t 𝜔, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+struct verify_pool_t
+{
+public:
+  using pkey_t = raccoon_pkey::pkey_t<𝜅, k, 𝜈t>;
+  using callback_t = std::function<void(bool)>;
+
+  // Number of prepared public keys, cached by each worker.
+  static constexpr size_t PKEY_CACHE_LEN = 4;
+
+private:
+  using prepared_pkey_t = raccoon_pkey::prepared_pkey_t<𝜅, k, l, 𝜈t>;
+  using pk_digest_t = std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits>;
+
+  struct job_t
+  {
+    pkey_t pkey{};
+    std::vector<uint8_t> msg{};
+    std::vector<uint8_t> sig{};
+    callback_t on_done{};
+  };
+
+  struct worker_t
+  {
+    std::mutex lock{};
+    std::deque<job_t> jobs{};
+
+    // Only ever touched by the worker thread itself
+    std::array<pk_digest_t, PKEY_CACHE_LEN> cached_digests{};
+    std::array<std::unique_ptr<prepared_pkey_t>, PKEY_CACHE_LEN> cached_pkeys{};
+    size_t next_evict = 0;
+  };
+
+  std::vector<std::unique_ptr<worker_t>> workers{};
+  std::atomic<size_t> next_worker{ 0 };
+  std::atomic<size_t> num_pending{ 0 };
+
+  std::mutex sleep_lock{};
+  std::condition_variable_any has_job{};
+  std::vector<std::jthread> threads{};
+
+  // Takes a job from the front of worker's own deque.
+  bool try_pop(worker_t& worker, job_t& job)
+  {
+    std::scoped_lock guard(worker.lock);
+    if (worker.jobs.empty()) {
+      return false;
+    }
+
+    job = std::move(worker.jobs.front());
+    worker.jobs.pop_front();
+    return true;
+  }
+
+  // Steals a job from the back of some other worker's deque, visiting them in order, starting from the next one.
+  bool try_steal(const size_t self, job_t& job)
+  {
+    for (size_t i = 1; i < this->workers.size(); i++) {
+      auto& victim = *this->workers[(self + i) % this->workers.size()];
+
+      std::scoped_lock guard(victim.lock);
+      if (!victim.jobs.empty()) {
+        job = std::move(victim.jobs.back());
+        victim.jobs.pop_back();
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  // Returns worker's prepared copy of the public key, preparing it and evicting the oldest cached one, on a miss.
+  const prepared_pkey_t& prepared(worker_t& worker, const pkey_t& pkey, const pk_digest_t& pk_digest)
+  {
+    for (size_t i = 0; i < PKEY_CACHE_LEN; i++) {
+      if (worker.cached_pkeys[i] && (worker.cached_digests[i] == pk_digest)) {
+        return *worker.cached_pkeys[i];
+      }
+    }
+
+    const size_t slot = worker.next_evict;
+    worker.next_evict = (worker.next_evict + 1) % PKEY_CACHE_LEN;
+
+    worker.cached_digests[slot] = pk_digest;
+    worker.cached_pkeys[slot] = std::make_unique<prepared_pkey_t>(pkey);
+    return *worker.cached_pkeys[slot];
+  }
+
+  bool verify(worker_t& worker, const job_t& job)
+  {
+    if (job.sig.size() != sig_byte_len) {
+      return false;
+    }
+
+    pk_digest_t 𝜇{};
+    job.pkey.hash(𝜇);
+
+    const auto& ppk = this->prepared(worker, job.pkey, 𝜇);
+    raccoon_challenge::msg_hash<𝜅>(𝜇, job.msg, 𝜇);
+
+    return ppk.template verify_digest<𝜈w, 𝜔, sig_byte_len, Binf, B22>(𝜇, std::span<const uint8_t, sig_byte_len>(job.sig));
+  }
+
+  // Keeps executing jobs, either its own or stolen ones, until stop is requested and there are no more pending jobs.
+  void work(std::stop_token stoken, const size_t self)
+  {
+    auto& worker = *this->workers[self];
+
+    while (true) {
+      job_t job{};
+
+      if (this->try_pop(worker, job) || this->try_steal(self, job)) {
+        this->num_pending.fetch_sub(1);
+        job.on_done(this->verify(worker, job));
+        continue;
+      }
+
+      std::unique_lock guard(this->sleep_lock);
+      if (!this->has_job.wait(guard, stoken, [this] { return this->num_pending.load() > 0; })) {
+        // Stop was requested and there's nothing left to be verified
+        return;
+      }
+    }
+  }
+
+public:
+  // Spawns `num_threads` (>0) -many worker threads. Defaults to number of concurrent threads supported by the hardware.
+  explicit verify_pool_t(const size_t num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1))
+  {
+    const size_t num_workers = std::max<size_t>(num_threads, 1);
+
+    this->workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; i++) {
+      this->workers.push_back(std::make_unique<worker_t>());
+    }
+
+    this->threads.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; i++) {
+      this->threads.emplace_back([this, i](std::stop_token stoken) { this->work(stoken, i); });
+    }
+  }
+
+  verify_pool_t(const verify_pool_t&) = delete;
+  verify_pool_t& operator=(const verify_pool_t&) = delete;
+
+  // Stops workers, after draining pending jobs.
+  ~verify_pool_t()
+  {
+    for (auto& thread : this->threads) {
+      thread.request_stop();
+    }
+    this->threads.clear();
+  }
+
+  // Number of worker threads in the pool.
+  size_t num_threads() const { return this->threads.size(); }
+
+  // Enqueues a verification job, whose outcome is passed to `on_done`, on one of the worker threads. Callback must not throw.
+  void submit(const pkey_t& pkey, std::vector<uint8_t> msg, std::vector<uint8_t> sig, callback_t on_done)
+  {
+    auto& worker = *this->workers[this->next_worker.fetch_add(1, std::memory_order_relaxed) % this->workers.size()];
+
+    // Counted before being enqueued, so that a worker, which takes it, never sees the count go below zero
+    this->num_pending.fetch_add(1);
+
+    {
+      std::scoped_lock guard(worker.lock);
+      worker.jobs.push_back(job_t{ pkey, std::move(msg), std::move(sig), std::move(on_done) });
+    }
+
+    // Taking the lock ensures that a worker is either yet to check for pending jobs or is already waiting, so that notification isn't lost
+    {
+      std::scoped_lock guard(this->sleep_lock);
+    }
+    this->has_job.notify_one();
+  }
+
+  // Enqueues a verification job, returning a future, which resolves to its outcome.
+  std::future<bool> submit(const pkey_t& pkey, std::vector<uint8_t> msg, std::vector<uint8_t> sig)
+  {
+    auto promise = std::make_shared<std::promise<bool>>();
+    auto future = promise->get_future();
+
+    this->submit(pkey, std::move(msg), std::move(sig), [promise](const bool is_verified) { promise->set_value(is_verified); });
+    return future;
+  }
+};
+
+}
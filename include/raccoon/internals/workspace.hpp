@@ -0,0 +1,160 @@
+#pragma once
+#include "raccoon/internals/polynomial/poly_mat.hpp"
+#include "raccoon/internals/polynomial/poly_vec.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+// Caller owned memory, for holding large intermediates of key generation, signing and verification
+namespace raccoon_workspace {
+
+// Alignment of workspace objects, so that each of them starts at a cache line boundary.
+constexpr size_t ALIGNMENT = 64;
+
+// Zeroes memory backing an object, using volatile writes, so that compiler doesn't optimize them away.
+template<typename T>
+inline void
+secure_zero(T& obj)
+{
+  volatile auto ptr = reinterpret_cast<volatile uint8_t*>(&obj);
+  for (size_t i = 0; i < sizeof(T); i++) {
+    ptr[i] = 0;
+  }
+}
+
+// Deleter, zeroing the object before releasing its memory, for heap allocated intermediates holding shares of secret key or ephemeral secrets.
+struct secure_delete_t
+{
+  template<typename T>
+  void operator()(T* const obj) const
+  {
+    secure_zero(*obj);
+    delete obj;
+  }
+};
+
+// Owning pointer to heap allocated secret dependent intermediates, which are wiped when released, along with a helper for allocating them.
+template<typename T>
+using secure_ptr_t = std::unique_ptr<T, secure_delete_t>;
+
+template<typename T, typename... Args>
+secure_ptr_t<T>
+make_secure(Args&&... args)
+{
+  return secure_ptr_t<T>(new T(std::forward<Args>(args)...));
+}
+
+// Intermediates of a single signing attempt, which is steps 4-20 of algorithm 2 of the specification, whose size grows with number of shares `d`.
+//
+// - masked vector `[[r]]`, which is also reused for holding masked response vector `[[z]]`
+// - masked commitment vector `[[w]]`
+// - rounded, unmasked commitment vector `w'`
+template<size_t k, size_t l, size_t d>
+struct alignas(ALIGNMENT) attempt_workspace_t
+{
+  raccoon_poly_vec::poly_vec_t<l, d> r{};
+  raccoon_poly_vec::poly_vec_t<k, d> w{};
+  raccoon_poly_vec::poly_vec_t<k, 1> w_prime{};
+};
+
+// Intermediates of signing, which is algorithm 2 of the specification.
+//
+// - public matrix A, expanded from the seed
+// - copy of masked secret key vector `[[s]]`, which is refreshed in place, in each signing attempt
+// - intermediates of a signing attempt
+//
+// A workspace can be reused across signing calls, without being cleared, as each field is overwritten before being read. Use `clear` for wiping secret
+// dependent fields, once the workspace is not going to be reused.
+template<size_t k, size_t l, size_t d>
+struct alignas(ALIGNMENT) sign_workspace_t
+{
+  raccoon_poly_mat::poly_mat_t<k, l> A{};
+  raccoon_poly_vec::poly_vec_t<l, d> s{};
+  attempt_workspace_t<k, l, d> attempt{};
+
+  // Byte length of the workspace, for a given parameter set and number of shares.
+  static constexpr size_t get_byte_len() { return sizeof(sign_workspace_t); }
+
+  // Zeroes fields, holding shares of secret key and of ephemeral secrets.
+  void clear()
+  {
+    secure_zero(this->s);
+    secure_zero(this->attempt.r);
+    secure_zero(this->attempt.w);
+  }
+};
+
+// Intermediates of signing, using a secret key, whose shares of `[[s]]` are refreshed in epochs, on a background thread ( see `epoch_skey_t` ).
+//
+// - signer's own copy of masked secret key vector `[[s]]`, which is refreshed in place, in each signing attempt
+// - key and epoch, the copy of `[[s]]` was taken from, so that it's copied again only once the key moves on to another epoch
+// - intermediates of a signing attempt
+//
+// Unlike other workspaces, copy of `[[s]]` stays resident across signing calls. Use `clear` for wiping secret dependent fields, which also makes next
+// signing call copy `[[s]]` afresh.
+template<size_t k, size_t l, size_t d>
+struct alignas(ALIGNMENT) epoch_sign_workspace_t
+{
+  raccoon_poly_vec::poly_vec_t<l, d> s{};
+  attempt_workspace_t<k, l, d> attempt{};
+  uint64_t key_id = 0;
+  uint64_t epoch = 0;
+
+  // Byte length of the workspace, for a given parameter set and number of shares.
+  static constexpr size_t get_byte_len() { return sizeof(epoch_sign_workspace_t); }
+
+  // Zeroes fields, holding ephemeral secrets of a signing attempt.
+  void clear_attempt()
+  {
+    secure_zero(this->attempt.r);
+    secure_zero(this->attempt.w);
+  }
+
+  // Zeroes fields, holding shares of secret key and of ephemeral secrets, forgetting which key they were taken from.
+  void clear()
+  {
+    secure_zero(this->s);
+    this->clear_attempt();
+    this->key_id = 0;
+  }
+};
+
+// Intermediates of key generation, which is algorithm 1 of the specification.
+//
+// - public matrix A, expanded from the seed
+// - masked secret key vector `[[s]]`
+// - masked vector `[[t]]`, before it's collapsed into public key
+//
+// Same as signing workspace, it can be reused across calls, without being cleared.
+template<size_t k, size_t l, size_t d>
+struct alignas(ALIGNMENT) keygen_workspace_t
+{
+  raccoon_poly_mat::poly_mat_t<k, l> A{};
+  raccoon_poly_vec::poly_vec_t<l, d> s{};
+  raccoon_poly_vec::poly_vec_t<k, d> t{};
+
+  // Byte length of the workspace, for a given parameter set and number of shares.
+  static constexpr size_t get_byte_len() { return sizeof(keygen_workspace_t); }
+
+  // Zeroes fields, holding shares of secret key.
+  void clear()
+  {
+    secure_zero(this->s);
+    secure_zero(this->t);
+  }
+};
+
+// Intermediates of verification, which is algorithm 3 of the specification.
+//
+// - public matrix A, expanded from the seed
+template<size_t k, size_t l>
+struct alignas(ALIGNMENT) verify_workspace_t
+{
+  raccoon_poly_mat::poly_mat_t<k, l> A{};
+
+  // Byte length of the workspace, for a given parameter set.
+  static constexpr size_t get_byte_len() { return sizeof(verify_workspace_t); }
+};
+
+}
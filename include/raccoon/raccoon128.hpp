@@ -1,6 +1,13 @@
 #pragma once
+#include "internals/async.hpp"
+#include "internals/pkey_registry.hpp"
 #include "internals/public_key.hpp"
 #include "internals/secret_key.hpp"
+#include "internals/shared_matrix.hpp"
+#include "internals/shm_matrix_cache.hpp"
+#include "internals/streaming.hpp"
+#include "internals/verify_cache.hpp"
+#include "internals/verify_pool.hpp"
 
 // Raccoon-128 Signing Algorithm.
 namespace raccoon128 {
@@ -28,6 +35,38 @@ static constexpr size_t PKEY_BYTE_LEN = raccoon_utils::get_pkey_byte_len<𝜅, k
 // Raccoon-128 signature byte length.
 static constexpr size_t SIG_BYTE_LEN = 11524ul;
 
+// Raccoon-128 message digest 𝜇 byte length, binding public key with message.
+static constexpr size_t MU_BYTE_LEN = (2 * 𝜅) / std::numeric_limits<uint8_t>::digits;
+
+// Raccoon-128 bounded, thread-safe pool of precomputed signing commitments, for offline/ online signing using a prepared secret key. Each pool serves a
+// single key, as commitments are computed under its public matrix A.
+template<size_t d>
+using raccoon128_presig_pool_t = raccoon_presig::presig_pool_t<𝜅, k, l, d>;
+
+// Raccoon-128 caller owned workspaces, holding large intermediates of key generation, signing and verification. Byte length of each of them can be queried
+// at compile-time, using `get_byte_len()`.
+template<size_t d>
+using raccoon128_keygen_workspace_t = raccoon_workspace::keygen_workspace_t<k, l, d>;
+template<size_t d>
+using raccoon128_sign_workspace_t = raccoon_workspace::sign_workspace_t<k, l, d>;
+template<size_t d>
+using raccoon128_epoch_sign_workspace_t = raccoon_workspace::epoch_sign_workspace_t<k, l, d>;
+using raccoon128_verify_workspace_t = raccoon_workspace::verify_workspace_t<k, l>;
+
+// Raccoon-128 report of staged verification, naming the stage, which rejected the signature, along with cycles spent in each stage.
+using raccoon128_verify_stage_t = raccoon_pkey::verify_stage_t;
+using raccoon128_verify_report_t = raccoon_pkey::verify_report_t;
+
+struct raccoon128_verifier_t;
+struct raccoon128_mu_hasher_t;
+struct raccoon128_async_verifier_t;
+struct raccoon128_verify_pool_t;
+struct raccoon128_verify_cache_t;
+template<size_t d>
+struct raccoon128_signer_t;
+template<size_t d>
+struct raccoon128_async_signer_t;
+
 // Raccoon-128 Public Key.
 struct raccoon128_pkey_t
 {
@@ -35,6 +74,13 @@ private:
   using pk128_t = raccoon_pkey::pkey_t<𝜅, k, 𝜈t>;
   pk128_t pk{};
 
+  friend struct raccoon128_prepared_pkey_t;
+  friend struct raccoon128_mu_hasher_t;
+  friend struct raccoon128_verify_pool_t;
+  friend struct raccoon128_verify_cache_t;
+  friend struct raccoon128_shared_pkey_t;
+  friend struct raccoon128_shm_pkey_t;
+
 public:
   explicit constexpr raccoon128_pkey_t(pk128_t pk)
     : pk(pk){};
@@ -53,6 +99,473 @@ public:
   {
     return this->pk.verify<l, 𝜈w, 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes);
   }
+
+  // Same as above, but keeps large intermediates of verification in caller supplied workspace.
+  constexpr bool verify(std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes, raccoon128_verify_workspace_t& ws) const
+  {
+    return this->pk.verify<l, 𝜈w, 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes, ws);
+  }
+
+  // Same as `verify`, but generates public matrix A one row at a time, consuming each row as soon as it's generated, instead of materializing the whole
+  // matrix, so that peak memory of verification is a few polynomials, on top of the decoded signature.
+  constexpr bool verify_streaming(std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    return this->pk.verify_streaming<l, 𝜈w, 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes);
+  }
+
+  // Same as `verify`, but runs in variable-time, taking data dependent shortcuts, which is safe as verification only handles public data. Outcome of
+  // verification is same as that of `verify`.
+  constexpr bool verify_vartime(std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    return this->pk.verify<l, 𝜈w, 𝜔, sig_bytes.size(), Binf, B22, raccoon_timing::variable_time_t>(msg, sig_bytes);
+  }
+
+  // Verifies a (message, signature) pair, as a pipeline of stages ordered by their cost i.e. size check, decoding, norms check, computing challenge and
+  // finally checking commitment, reporting the stage, which rejected the signature ( or `accepted` ), along with cycles spent in each stage. Signature of
+  // any byte length is accepted. Runs in variable-time, same as `verify_vartime`, so that malformed signatures get rejected as early as possible.
+  raccoon128_verify_report_t verify_staged(std::span<const uint8_t> msg, std::span<const uint8_t> sig_bytes) const
+  {
+    return this->pk.verify_staged<l, 𝜈w, 𝜔, SIG_BYTE_LEN, Binf, B22, raccoon_timing::variable_time_t>(msg, sig_bytes);
+  }
+
+  // Given externally computed message digest 𝜇 ( see `raccoon128_mu_hasher_t` ) and signature as byte arrays, verifies the validity of signature,
+  // returning boolean truth value in case of success.
+  constexpr bool verify_mu(std::span<const uint8_t, MU_BYTE_LEN> mu, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    return this->pk.verify_digest<l, 𝜈w, 𝜔, sig_bytes.size(), Binf, B22>(mu, sig_bytes);
+  }
+};
+
+// Raccoon-128 Public Key, prepared for verifying many signatures. It keeps public matrix A, `t << 𝜈t` and digest of the public key resident, so that
+// each verification call only does the signature dependent work.
+struct raccoon128_prepared_pkey_t
+{
+private:
+  using ppk128_t = raccoon_pkey::prepared_pkey_t<𝜅, k, l, 𝜈t>;
+  ppk128_t ppk{};
+
+  friend struct raccoon128_verifier_t;
+  friend struct raccoon128_mu_hasher_t;
+  friend struct raccoon128_async_verifier_t;
+  friend struct raccoon128_verify_cache_t;
+
+public:
+  explicit constexpr raccoon128_prepared_pkey_t(const raccoon128_pkey_t& pk)
+    : ppk(pk.pk){};
+
+  // Returns a copy of the Raccoon-128 public key, which was prepared.
+  constexpr raccoon128_pkey_t get_pkey() const { return raccoon128_pkey_t(this->ppk.get_pkey()); }
+
+  // Given a (message, signature) pair as byte arrays, verifies the validity of signature, returning boolean truth value in case of success.
+  constexpr bool verify(std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    return this->ppk.template verify<𝜈w, 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes);
+  }
+
+  // Same as `verify`, but runs in variable-time, taking data dependent shortcuts, which is safe as verification only handles public data. Outcome of
+  // verification is same as that of `verify`.
+  constexpr bool verify_vartime(std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    return this->ppk.template verify<𝜈w, 𝜔, sig_bytes.size(), Binf, B22, raccoon_timing::variable_time_t>(msg, sig_bytes);
+  }
+
+  // Verifies a (message, signature) pair, as a pipeline of stages ordered by their cost i.e. size check, decoding, norms check, computing challenge and
+  // finally checking commitment, reporting the stage, which rejected the signature ( or `accepted` ), along with cycles spent in each stage. Signature of
+  // any byte length is accepted. Runs in variable-time, same as `verify_vartime`, so that malformed signatures get rejected as early as possible.
+  raccoon128_verify_report_t verify_staged(std::span<const uint8_t> msg, std::span<const uint8_t> sig_bytes) const
+  {
+    return this->ppk.template verify_staged<𝜈w, 𝜔, SIG_BYTE_LEN, Binf, B22, raccoon_timing::variable_time_t>(msg, sig_bytes);
+  }
+
+  // Given externally computed message digest 𝜇 ( see `raccoon128_mu_hasher_t` ) and signature as byte arrays, verifies the validity of signature,
+  // returning boolean truth value in case of success.
+  constexpr bool verify_mu(std::span<const uint8_t, MU_BYTE_LEN> mu, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    return this->ppk.template verify_digest<𝜈w, 𝜔, sig_bytes.size(), Binf, B22>(mu, sig_bytes);
+  }
+
+  // Given a batch of messages and their signatures s.t. i-th signature is `sigs_bytes[i * SIG_BYTE_LEN, (i + 1) * SIG_BYTE_LEN)`, verifies each of them,
+  // writing outcome of i-th verification to `results[i]` and returning true, only if all of them are valid. Response vectors of many signatures are
+  // multiplied with public matrix A at once. Throws `std::invalid_argument`, if `sigs_bytes` or `results` don't hold exactly `msgs.size()` entries.
+  bool verify_batch(std::span<const std::span<const uint8_t>> msgs, std::span<const uint8_t> sigs_bytes, std::span<bool> results) const
+  {
+    return this->ppk.template verify_batch<𝜈w, 𝜔, SIG_BYTE_LEN, Binf, B22>(msgs, sigs_bytes, results);
+  }
+};
+
+// Raccoon-128 Message Digest Hasher, computing 𝜇 = H(H(pk) || msg), which binds public key with message, absorbing the message in arbitrary many chunks.
+// Computed 𝜇 can be shipped to the holder of the secret key, for signing by `sign_mu`, instead of the message itself.
+struct raccoon128_mu_hasher_t
+{
+private:
+  raccoon_challenge::msg_hasher_t<𝜅> hasher{};
+
+public:
+  explicit constexpr raccoon128_mu_hasher_t(const raccoon128_pkey_t& pk)
+  {
+    std::array<uint8_t, MU_BYTE_LEN> pk_digest{};
+    pk.pk.hash(pk_digest);
+    this->hasher = raccoon_challenge::msg_hasher_t<𝜅>(pk_digest);
+  }
+
+  explicit constexpr raccoon128_mu_hasher_t(const raccoon128_prepared_pkey_t& ppk)
+    : hasher(ppk.ppk.get_pk_digest()){};
+
+  // Absorbs next chunk of the message.
+  constexpr void update(std::span<const uint8_t> msg_chunk) { this->hasher.update(msg_chunk); }
+
+  // Finishes absorbing the message, producing its digest 𝜇. Must be called only once.
+  constexpr void finalize(std::span<uint8_t, MU_BYTE_LEN> mu) { this->hasher.finalize(mu); }
+
+  // Computes digest 𝜇 of a message, which is available as a whole.
+  static constexpr void compute(const raccoon128_pkey_t& pk, std::span<const uint8_t> msg, std::span<uint8_t, MU_BYTE_LEN> mu)
+  {
+    raccoon128_mu_hasher_t hasher(pk);
+    hasher.update(msg);
+    hasher.finalize(mu);
+  }
+};
+
+// Raccoon-128 Streaming Verifier, absorbing the message in arbitrary many chunks, using a prepared public key, which must outlive the verifier.
+struct raccoon128_verifier_t
+{
+private:
+  raccoon_stream::verifier_t<𝜅, k, l, 𝜈t> verifier;
+
+public:
+  explicit constexpr raccoon128_verifier_t(const raccoon128_prepared_pkey_t& ppk)
+    : verifier(ppk.ppk){};
+
+  // Absorbs next chunk of the message, whose signature is to be verified.
+  constexpr void update(std::span<const uint8_t> msg_chunk) { this->verifier.update(msg_chunk); }
+
+  // Finishes absorbing the message and verifies the signature, returning boolean truth value in case of success. Must be called only once.
+  constexpr bool final_verify(std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes)
+  {
+    return this->verifier.template final_verify<𝜈w, 𝜔, sig_bytes.size(), Binf, B22>(sig_bytes);
+  }
+};
+
+// Raccoon-128 Asynchronous Verifier, using a prepared public key, which must outlive the verifier and all of its verification tasks. Verification runs on
+// given executor, which defaults to a process-wide thread pool, so that awaiting coroutine never blocks on it.
+struct raccoon128_async_verifier_t
+{
+private:
+  raccoon_async::verifier_t<𝜅, k, l, 𝜈t> verifier;
+
+public:
+  explicit raccoon128_async_verifier_t(const raccoon128_prepared_pkey_t& ppk,
+                                       raccoon_thread_pool::thread_pool_t& ex = raccoon_async::default_executor())
+    : verifier(ppk.ppk, ex){};
+
+  // Verifies a signature over a message, both of which must stay alive until the task completes. Awaiting coroutine is resumed on verifier's executor.
+  raccoon_async::task_t<bool> verify_async(std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    return this->verifier.template verify_async<𝜈w, 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes);
+  }
+
+  // Same as above, but awaiting coroutine is resumed on the `completion` executor.
+  template<raccoon_async::executor_c E>
+  raccoon_async::task_t<bool> verify_async(std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes, E& completion) const
+  {
+    return this->verifier.template verify_async<𝜈w, 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes, completion);
+  }
+};
+
+// Raccoon-128 Verification Pool, verifying (public key, message, signature) jobs, on many worker threads, with work stealing. Each worker keeps a few
+// recently used public keys prepared, so that jobs under the same key skip key dependent setup.
+struct raccoon128_verify_pool_t
+{
+private:
+  using pool128_t = raccoon_verify_pool::verify_pool_t<𝜅, k, l, 𝜈t, 𝜈w, 𝜔, SIG_BYTE_LEN, Binf, B22>;
+  pool128_t pool;
+
+public:
+  explicit raccoon128_verify_pool_t(const size_t num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1))
+    : pool(num_threads){};
+
+  // Number of worker threads in the pool.
+  size_t num_threads() const { return this->pool.num_threads(); }
+
+  // Enqueues verification of a signature over a message, under given public key, returning a future, which resolves to its outcome. Signature of
+  // length other than `SIG_BYTE_LEN` is rejected.
+  std::future<bool> submit(const raccoon128_pkey_t& pkey, std::vector<uint8_t> msg, std::vector<uint8_t> sig_bytes)
+  {
+    return this->pool.submit(pkey.pk, std::move(msg), std::move(sig_bytes));
+  }
+
+  // Same as above, but passes the outcome to `on_done`, on one of the worker threads, instead. Callback must not throw.
+  void submit(const raccoon128_pkey_t& pkey, std::vector<uint8_t> msg, std::vector<uint8_t> sig_bytes, std::function<void(bool)> on_done)
+  {
+    this->pool.submit(pkey.pk, std::move(msg), std::move(sig_bytes), std::move(on_done));
+  }
+};
+
+// Raccoon-128 bounded, thread-safe cache of successful verifications, short-circuiting repeated verification of the same (public key, message, signature)
+// triple. Only successful verifications are cached, hence a hit always means the signature is valid.
+struct raccoon128_verify_cache_t
+{
+private:
+  using cache128_t = raccoon_verify_cache::verify_cache_t<𝜅, k, l, 𝜈t, 𝜈w, 𝜔, SIG_BYTE_LEN, Binf, B22>;
+  cache128_t cache;
+
+public:
+  // Creates a cache, holding at most `capacity` (>0) -many entries, spread over `num_shards` (>0) -many independently locked shards.
+  explicit raccoon128_verify_cache_t(const size_t capacity, const size_t num_shards = cache128_t::NUM_SHARDS)
+    : cache(capacity, num_shards){};
+
+  // Given a public key and a (message, signature) pair as byte arrays, verifies the validity of signature, answering from the cache, if the same triple
+  // was already verified successfully. Outcome of verification is same as that of `raccoon128_pkey_t::verify`.
+  bool verify(const raccoon128_pkey_t& pkey, std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes)
+  {
+    return this->cache.verify(pkey.pk, msg, sig_bytes);
+  }
+
+  // Same as above, but using a prepared public key.
+  bool verify(const raccoon128_prepared_pkey_t& pkey, std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes)
+  {
+    return this->cache.verify(pkey.ppk, msg, sig_bytes);
+  }
+
+  // Number of entries, currently held by the cache, and maximum number of entries, it can hold.
+  size_t size() { return this->cache.size(); }
+  size_t capacity() const { return this->cache.capacity(); }
+
+  // Hit, miss, eviction and lock contention counters, accumulated since creation of the cache or since last call to `reset_stats`.
+  raccoon_verify_cache::cache_stats_t stats() const { return this->cache.stats(); }
+  void reset_stats() { this->cache.reset_stats(); }
+};
+
+// Raccoon-128 thread-safe registry of many public keys, keyed by caller chosen identifier, holding each of them in its compact byte serialized form,
+// while keeping a bounded set of recently used ones prepared for verification, so that a verifier can keep millions of public keys resident.
+template<typename id_t = uint64_t, typename id_hash_t = std::hash<id_t>>
+struct raccoon128_pkey_registry_t
+{
+private:
+  using registry128_t = raccoon_pkey_registry::pkey_registry_t<𝜅, k, l, 𝜈t, 𝜈w, 𝜔, SIG_BYTE_LEN, Binf, B22, id_t, id_hash_t>;
+  registry128_t registry;
+
+public:
+  // Creates a registry, which keeps at most `max_prepared` (>0) -many public keys prepared at once.
+  explicit raccoon128_pkey_registry_t(const size_t max_prepared)
+    : registry(max_prepared){};
+
+  // Registers byte serialized public key under given identifier, replacing the one already registered under it, if any. Returns true, only if the
+  // identifier wasn't registered before.
+  bool insert(const id_t& id, std::span<const uint8_t, PKEY_BYTE_LEN> pk_bytes) { return this->registry.insert(id, pk_bytes); }
+
+  // Removes public key registered under given identifier. Returns true, only if it was registered.
+  bool erase(const id_t& id) { return this->registry.erase(id); }
+
+  // Checks whether any public key is registered under given identifier.
+  bool contains(const id_t& id) const { return this->registry.contains(id); }
+
+  // Number of registered public keys and number of them, which are currently prepared.
+  size_t size() const { return this->registry.size(); }
+  size_t num_prepared() const { return this->registry.num_prepared(); }
+
+  // Given a (message, signature) pair as byte arrays, verifies the validity of signature under the public key registered under given identifier, preparing
+  // it, if not already prepared. Returns false, if no public key is registered under given identifier.
+  bool verify(const id_t& id, std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes)
+  {
+    return this->registry.verify(id, msg, sig_bytes);
+  }
+
+  // Hit, miss and eviction counters of prepared public keys, accumulated since creation of the registry or since last call to `reset_stats`.
+  raccoon_pkey_registry::registry_stats_t stats() const { return this->registry.stats(); }
+  void reset_stats() { this->registry.reset_stats(); }
+};
+
+// Raccoon-128 Secret Key with masking order (d-1) s.t. 0 < d <= 32, prepared for signing many messages. It keeps public matrix A, `t << 𝜈t`
+// and digest of the public key resident, so that each signing call only does the message dependent work.
+template<size_t d>
+struct raccoon128_prepared_skey_t
+{
+private:
+  using psk128_t = raccoon_skey::prepared_skey_t<𝜅, k, l, d, 𝜈t>;
+  psk128_t psk{};
+
+  template<size_t>
+  friend struct raccoon128_signer_t;
+  template<size_t>
+  friend struct raccoon128_async_signer_t;
+
+public:
+  explicit constexpr raccoon128_prepared_skey_t(const raccoon_skey::skey_t<𝜅, k, l, d, 𝜈t>& sk)
+    : psk(sk){};
+
+  // Returns a copy of the Raccoon-128 public key held inside the prepared secret key.
+  constexpr raccoon128_pkey_t get_pkey() const { return raccoon128_pkey_t(this->psk.get_skey().get_pkey()); }
+
+  // Given a message, signs it, producing a byte serialized signature.
+  constexpr void sign(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    this->psk.template sign<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes);
+  }
+
+  // Same as above, but keeps large intermediates of signing in caller supplied workspace.
+  constexpr void sign(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes, raccoon128_sign_workspace_t<d>& ws) const
+  {
+    this->psk.template sign<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes, ws);
+  }
+
+  // Given a message, signs it, producing a byte serialized signature, while refreshing the shares of the secret key in place, instead of copying them.
+  // Not safe to call concurrently, on the same object.
+  constexpr void sign_in_place(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes)
+  {
+    this->psk.template sign_in_place<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes);
+  }
+
+  // Given externally computed message digest 𝜇 ( see `raccoon128_mu_hasher_t` ), signs it, producing a byte serialized signature.
+  void sign_mu(std::span<const uint8_t, MU_BYTE_LEN> mu, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    this->psk.template sign_digest<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(mu, sig_bytes);
+  }
+
+  // Given a message, signs it, producing a byte serialized signature, one signing attempt after another, on the calling thread.
+  constexpr void sign(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes, raccoon_sign_policy::sequential_t) const
+  {
+    this->sign(msg, sig_bytes);
+  }
+
+  // Given a message, signs it, producing a byte serialized signature, while running speculative signing attempts in parallel, on the thread pool.
+  void sign(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes, const raccoon_sign_policy::speculative_t& policy) const
+  {
+    this->psk.template sign<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes, policy);
+  }
+
+  // Given a batch of messages, signs each of them, writing i-th signature to `sigs_bytes[i * SIG_BYTE_LEN, (i + 1) * SIG_BYTE_LEN)`. Key dependent setup
+  // is shared across the batch. If a thread pool is supplied, the batch is split across the calling thread and the pool workers, unless the calling
+  // thread is one of those workers. Throws `std::invalid_argument`, if `sigs_bytes` can't hold exactly `msgs.size()` signatures.
+  void sign_batch(std::span<const std::span<const uint8_t>> msgs,
+                  std::span<uint8_t> sigs_bytes,
+                  raccoon_thread_pool::thread_pool_t* const pool = nullptr) const
+  {
+    this->psk.template sign_batch<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, SIG_BYTE_LEN, Binf, B22>(msgs, sigs_bytes, pool);
+  }
+
+  // Given a message, signs it, producing a byte serialized signature, while consuming precomputed commitments from the pool. Falls back to computing
+  // commitment inline, when the pool is empty. Pool must be filled by this same key, else `std::invalid_argument` is thrown.
+  void sign(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes, raccoon128_presig_pool_t<d>& pool) const
+  {
+    this->psk.template sign<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes, pool);
+  }
+
+  // Tops up the pool with precomputed commitments, until it is full, without blocking.
+  void refill(raccoon128_presig_pool_t<d>& pool) const { this->psk.template refill<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()]>(pool); }
+
+  // Keeps filling the pool with precomputed commitments, until stop is requested. Meant to be run on a background worker thread, such as
+  // `std::jthread([&](std::stop_token st) { prepared_skey.produce(pool, st); })`.
+  void produce(raccoon128_presig_pool_t<d>& pool, std::stop_token stoken) const
+  {
+    this->psk.template produce<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()]>(pool, stoken);
+  }
+
+  // Refresh the shares of masked secret key polynomial vector `[[s]]`. Must not be called while the key is being used for signing, on another thread.
+  constexpr void refresh() { this->psk.refresh(); }
+};
+
+// Raccoon-128 Secret Key with masking order (d-1) s.t. 0 < d <= 32, prepared for signing concurrently from many threads. It keeps a fixed number of
+// independently refreshed share sets of the secret key, s.t. each signing call claims one and refreshes it in place, without ever copying the key.
+template<size_t d>
+struct raccoon128_pooled_skey_t
+{
+private:
+  using psk128_t = raccoon_skey::pooled_skey_t<𝜅, k, l, d, 𝜈t>;
+  psk128_t psk;
+
+public:
+  raccoon128_pooled_skey_t(const raccoon_skey::skey_t<𝜅, k, l, d, 𝜈t>& sk, const size_t num_share_sets)
+    : psk(sk, num_share_sets){};
+
+  // Number of share sets, held by this secret key.
+  size_t num_share_sets() const { return this->psk.num_share_sets(); }
+
+  // Given a message, signs it, producing a byte serialized signature. Safe to be called concurrently, from many threads.
+  void sign(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes)
+  {
+    this->psk.template sign<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes);
+  }
+};
+
+// Raccoon-128 Secret Key with masking order (d-1) s.t. 0 < d <= 32, serving concurrent signers from many threads, while shares of the secret key are
+// refreshed on a background thread, as per given cadence, following an epoch based read-copy-update scheme. Signers never lock. Each of them keeps its
+// own copy of the shares in a per-thread workspace, copied at most once per epoch, and refreshes it in place, in every signing attempt.
+template<size_t d>
+struct raccoon128_epoch_skey_t
+{
+private:
+  using esk128_t = raccoon_skey::epoch_skey_t<𝜅, k, l, d, 𝜈t>;
+  esk128_t esk;
+
+public:
+  raccoon128_epoch_skey_t(const raccoon_skey::skey_t<𝜅, k, l, d, 𝜈t>& sk, const raccoon_sign_policy::refresh_cadence_t cadence)
+    : esk(sk, cadence){};
+
+  // Number of times shares of the secret key have been refreshed, in the background.
+  uint64_t epoch() const { return this->esk.epoch(); }
+
+  // Requests a refresh of shares of the secret key, in the background, without waiting for it.
+  void refresh() { this->esk.refresh(); }
+
+  // Given a message, signs it, producing a byte serialized signature. Safe to be called concurrently, from many threads.
+  void sign(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes)
+  {
+    this->esk.template sign<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes);
+  }
+
+  // Same as above, but keeps copy of the shares and intermediates of signing in caller supplied workspace, which must not be shared by concurrent signers.
+  void sign(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes, raccoon128_epoch_sign_workspace_t<d>& ws)
+  {
+    this->esk.template sign<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes, ws);
+  }
+};
+
+// Raccoon-128 Streaming Signer, absorbing the message in arbitrary many chunks, using a prepared secret key, which must outlive the signer. Commitment of
+// the first signing attempt is computed on a background thread, while the message is streamed in.
+template<size_t d>
+struct raccoon128_signer_t
+{
+private:
+  raccoon_stream::signer_t<𝜅, k, l, d, 𝜈t, 𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()]> signer;
+
+public:
+  explicit raccoon128_signer_t(const raccoon128_prepared_skey_t<d>& psk)
+    : signer(psk.psk){};
+
+  // Absorbs next chunk of the message to be signed.
+  void update(std::span<const uint8_t> msg_chunk) { this->signer.update(msg_chunk); }
+
+  // Finishes absorbing the message and signs it, producing a byte serialized signature. Must be called only once.
+  void final_sign(std::span<uint8_t, SIG_BYTE_LEN> sig_bytes) { this->signer.template final_sign<𝜔, sig_bytes.size(), Binf, B22>(sig_bytes); }
+};
+
+// Raccoon-128 Asynchronous Signer, using a prepared secret key, which must outlive the signer and all of its signing tasks. Signing runs on given
+// executor, which defaults to a process-wide thread pool, yielding back to it between signing steps, so that awaiting coroutine never blocks on it.
+template<size_t d>
+struct raccoon128_async_signer_t
+{
+private:
+  raccoon_async::signer_t<𝜅, k, l, d, 𝜈t, 𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()]> signer;
+
+public:
+  explicit raccoon128_async_signer_t(const raccoon128_prepared_skey_t<d>& psk,
+                                     raccoon_thread_pool::thread_pool_t& ex = raccoon_async::default_executor())
+    : signer(psk.psk, ex){};
+
+  // Signs a message, which must stay alive until the task completes, producing a byte serialized signature. Awaiting coroutine is resumed on signer's
+  // executor.
+  raccoon_async::task_t<std::array<uint8_t, SIG_BYTE_LEN>> sign_async(std::span<const uint8_t> msg) const
+  {
+    return this->signer.template sign_async<𝜔, SIG_BYTE_LEN, Binf, B22>(msg);
+  }
+
+  // Same as above, but awaiting coroutine is resumed on the `completion` executor.
+  template<raccoon_async::executor_c E>
+  raccoon_async::task_t<std::array<uint8_t, SIG_BYTE_LEN>> sign_async(std::span<const uint8_t> msg, E& completion) const
+  {
+    return this->signer.template sign_async<𝜔, SIG_BYTE_LEN, Binf, B22>(msg, completion);
+  }
 };
 
 // Raccoon-128 Secret Key with masking order (d-1) s.t. 0 < d <= 32.
@@ -86,17 +599,212 @@ public:
     return raccoon128_skey_t(sk128_t::template generate<𝑢t[raccoon_utils::log2<d>()], rep[raccoon_utils::log2<d>()]>(seed));
   }
 
+  // Same as above, but keeps large intermediates of key generation in caller supplied workspace.
+  static constexpr raccoon128_skey_t generate(std::span<const uint8_t, SEED_BYTE_LEN> seed, raccoon128_keygen_workspace_t<d>& ws)
+  {
+    return raccoon128_skey_t(sk128_t::template generate<𝑢t[raccoon_utils::log2<d>()], rep[raccoon_utils::log2<d>()]>(seed, ws));
+  }
+
   // Returns a copy of the Raccoon-128 public key held inside the secret key.
   constexpr raccoon128_pkey_t get_pkey() const { return raccoon128_pkey_t(this->sk.get_pkey()); }
 
+  // Prepares the Raccoon-128 secret key for signing many messages, computing key dependent state only once.
+  constexpr raccoon128_prepared_skey_t<d> prepare() const { return raccoon128_prepared_skey_t<d>(this->sk); }
+
+  // Prepares the Raccoon-128 secret key for signing concurrently from many threads, keeping `num_share_sets` -many independently refreshed share sets.
+  // Returned on heap, as it is neither copyable nor movable.
+  std::unique_ptr<raccoon128_pooled_skey_t<d>> prepare_pooled(const size_t num_share_sets) const
+  {
+    return std::make_unique<raccoon128_pooled_skey_t<d>>(this->sk, num_share_sets);
+  }
+
+  // Prepares the Raccoon-128 secret key for signing concurrently from many threads, while its shares are refreshed in the background, as per given
+  // cadence. Returned on heap, as it is neither copyable nor movable. Throws `std::invalid_argument`, if both triggers of the cadence are disabled.
+  std::unique_ptr<raccoon128_epoch_skey_t<d>> prepare_epoch(const raccoon_sign_policy::refresh_cadence_t cadence) const
+  {
+    return std::make_unique<raccoon128_epoch_skey_t<d>>(this->sk, cadence);
+  }
+
   // Given a message, signs it, producing a byte serialized signature.
   constexpr void sign(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes) const
   {
     this->sk.template sign<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes);
   }
 
+  // Same as above, but keeps large intermediates of signing in caller supplied workspace.
+  constexpr void sign(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes, raccoon128_sign_workspace_t<d>& ws) const
+  {
+    this->sk.template sign<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes, ws);
+  }
+
+  // Given a message, signs it, producing a byte serialized signature, while refreshing the shares of the secret key in place, instead of copying them.
+  // Not safe to call concurrently, on the same object.
+  constexpr void sign_in_place(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes)
+  {
+    this->sk.template sign_in_place<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes);
+  }
+
+  // Given externally computed message digest 𝜇 ( see `raccoon128_mu_hasher_t` ), signs it, producing a byte serialized signature.
+  constexpr void sign_mu(std::span<const uint8_t, MU_BYTE_LEN> mu, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    this->sk.template sign_digest<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(mu, sig_bytes);
+  }
+
+  // Given a message, signs it, producing a byte serialized signature, one signing attempt after another, on the calling thread.
+  constexpr void sign(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes, raccoon_sign_policy::sequential_t) const
+  {
+    this->sign(msg, sig_bytes);
+  }
+
+  // Given a message, signs it, producing a byte serialized signature, while running speculative signing attempts in parallel, on the thread pool.
+  void sign(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes, const raccoon_sign_policy::speculative_t& policy) const
+  {
+    this->sk.template sign<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes, policy);
+  }
+
+  // Given a batch of messages, signs each of them, writing i-th signature to `sigs_bytes[i * SIG_BYTE_LEN, (i + 1) * SIG_BYTE_LEN)`, after preparing the
+  // secret key only once for the whole batch. See `raccoon128_prepared_skey_t::sign_batch`.
+  void sign_batch(std::span<const std::span<const uint8_t>> msgs,
+                  std::span<uint8_t> sigs_bytes,
+                  raccoon_thread_pool::thread_pool_t* const pool = nullptr) const
+  {
+    this->prepare().sign_batch(msgs, sigs_bytes, pool);
+  }
+
   // Refresh the shares of masked secret key polynomial vector `[[s]]`
   constexpr void refresh() { this->sk.refresh(); }
 };
 
+// Raccoon-128 public matrix A, expanded once from a deployment-wide seed and shared by all keys of the deployment ( see `raccoon128_shared_pkey_t` and
+// `raccoon128_shared_skey_t` ). Get the process-wide instance for a seed, using `raccoon128_shared_matrix_t::get(seed)`.
+//
+// Note, this mode deviates from the specification, where each key comes with its own, freshly sampled, public matrix. Keys generated in this mode are
+// still well-formed Raccoon-128 keys, whose signatures verify using `raccoon128_pkey_t`, but all of them share the same public matrix.
+using raccoon128_shared_matrix_t = raccoon_shared_matrix::shared_matrix_t<𝜅, k, l>;
+
+// Raccoon-128 Public Key, whose seed is the deployment-wide one, verifying signatures using the shared public matrix A, instead of expanding it.
+struct raccoon128_shared_pkey_t
+{
+private:
+  using pk128_t = raccoon_pkey::pkey_t<𝜅, k, 𝜈t>;
+
+  std::shared_ptr<const raccoon128_shared_matrix_t> A{};
+  pk128_t pk{};
+
+public:
+  // Binds a public key to the shared public matrix A. Throws `std::invalid_argument`, if the public key doesn't carry the seed, A was expanded from.
+  raccoon128_shared_pkey_t(std::shared_ptr<const raccoon128_shared_matrix_t> A, const raccoon128_pkey_t& pkey)
+    : A(std::move(A))
+    , pk(pkey.pk)
+  {
+    if (!this->A || !this->A->is_expanded_from(this->pk.get_seed())) {
+      throw std::invalid_argument("public key doesn't belong to the shared public matrix");
+    }
+  }
+
+  // Same as above, but deserializes the public key from given byte array.
+  raccoon128_shared_pkey_t(std::shared_ptr<const raccoon128_shared_matrix_t> A, std::span<const uint8_t, PKEY_BYTE_LEN> pk_bytes)
+    : raccoon128_shared_pkey_t(std::move(A), raccoon128_pkey_t(pk_bytes))
+  {
+  }
+
+  // Returns a copy of the Raccoon-128 public key, which can be verified against, without the shared matrix.
+  raccoon128_pkey_t get_pkey() const { return raccoon128_pkey_t(this->pk); }
+
+  // Given a (message, signature) pair as byte arrays, verifies the validity of signature, returning boolean truth value in case of success. Outcome of
+  // verification is same as that of `raccoon128_pkey_t::verify`.
+  bool verify(std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    return this->pk.verify_using<l, 𝜈w, 𝜔, sig_bytes.size(), Binf, B22>(this->A->get_A(), msg, sig_bytes);
+  }
+};
+
+// Raccoon-128 Secret Key with masking order (d-1) s.t. 0 < d <= 32, whose public key carries the deployment-wide seed, generating keys and signing
+// messages using the shared public matrix A, instead of expanding it.
+template<size_t d>
+struct raccoon128_shared_skey_t
+{
+private:
+  using sk128_t = raccoon_skey::skey_t<𝜅, k, l, d, 𝜈t>;
+
+  std::shared_ptr<const raccoon128_shared_matrix_t> A{};
+  sk128_t sk{};
+
+  raccoon128_shared_skey_t(std::shared_ptr<const raccoon128_shared_matrix_t> A, sk128_t sk)
+    : A(std::move(A))
+    , sk(sk){};
+
+public:
+  // Generates a new Raccoon-128 keypair, whose public key carries seed of the shared public matrix A. Throws `std::invalid_argument`, if `A` is null.
+  static raccoon128_shared_skey_t generate(std::shared_ptr<const raccoon128_shared_matrix_t> A)
+  {
+    if (!A) {
+      throw std::invalid_argument("shared public matrix must not be null");
+    }
+
+    const auto ws = raccoon_workspace::make_secure<raccoon128_keygen_workspace_t<d>>();
+    auto sk = sk128_t::template generate_with<𝑢t[raccoon_utils::log2<d>()], rep[raccoon_utils::log2<d>()]>(A->get_seed(), A->get_A(), *ws);
+
+    return raccoon128_shared_skey_t(std::move(A), sk);
+  }
+
+  // Returns the public key, bound to the same shared public matrix A.
+  raccoon128_shared_pkey_t get_pkey() const { return raccoon128_shared_pkey_t(this->A, raccoon128_pkey_t(this->sk.get_pkey())); }
+
+  // Given a message, signs it, producing a byte serialized signature.
+  void sign(std::span<const uint8_t> msg, std::span<uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    this->sk.template sign_using<𝑢w[raccoon_utils::log2<d>()], 𝜈w, rep[raccoon_utils::log2<d>()], 𝜔, sig_bytes.size(), Binf, B22>(
+      this->A->get_A(), msg, sig_bytes);
+  }
+
+  // Refresh the shares of masked secret key polynomial vector `[[s]]`
+  void refresh() { this->sk.refresh(); }
+};
+
+// Raccoon-128 cache of public matrices A, living in a POSIX shared memory object or a memfd, which is attached to by many verifier processes on the same
+// host, so that each public matrix gets expanded only once per host, instead of once per process. Open it by name, using
+// `raccoon128_shm_matrix_cache_t::open(name, num_slots)`, or map a memfd, using `raccoon128_shm_matrix_cache_t::attach(fd, num_slots)`. Every process attached
+// to it must be trusted, as it can rewrite any public matrix. Pass `raccoon128_shm_trust_t::checked`, as last argument, to have this process check each
+// matrix against the digest stored along with it, before first using it, which catches corrupted slots, not malicious writers.
+using raccoon128_shm_matrix_cache_t = raccoon_shm_matrix_cache::shm_matrix_cache_t<𝜅, k, l>;
+using raccoon128_shm_trust_t = raccoon_shm_matrix_cache::trust_t;
+
+// Raccoon-128 Public Key, prepared for verifying many signatures, same as `raccoon128_prepared_pkey_t`, except that public matrix A lives in a shared memory
+// matrix cache, where it's expanded by the first process asking for it and then used in place by all of them.
+struct raccoon128_shm_pkey_t
+{
+private:
+  using ppk128_t = raccoon_shm_matrix_cache::shm_prepared_pkey_t<𝜅, k, l, 𝜈t>;
+  ppk128_t ppk;
+
+public:
+  // Prepares a public key, borrowing its public matrix A from given cache, which must be obtained using `open` or `attach`. In case every slot of the cache
+  // is in use, A is expanded in process-local memory instead.
+  raccoon128_shm_pkey_t(const raccoon128_shm_matrix_cache_t& cache, const raccoon128_pkey_t& pkey)
+    : ppk(cache, pkey.pk){};
+
+  // Same as above, but deserializes the public key from given byte array.
+  raccoon128_shm_pkey_t(const raccoon128_shm_matrix_cache_t& cache, std::span<const uint8_t, PKEY_BYTE_LEN> pk_bytes)
+    : raccoon128_shm_pkey_t(cache, raccoon128_pkey_t(pk_bytes)){};
+
+  // Returns a copy of the Raccoon-128 public key, which was prepared.
+  raccoon128_pkey_t get_pkey() const { return raccoon128_pkey_t(this->ppk.get_pkey()); }
+
+  // Whether public matrix A is borrowed from the shared memory segment, instead of being expanded in process-local memory.
+  bool is_shared() const { return this->ppk.is_shared(); }
+
+  // Given a (message, signature) pair as byte arrays, verifies the validity of signature, returning boolean truth value in case of success.
+  bool verify(std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    return this->ppk.template verify<𝜈w, 𝜔, sig_bytes.size(), Binf, B22>(msg, sig_bytes);
+  }
+
+  // Same as `verify`, but runs in variable-time, which is safe as verification only handles public data.
+  bool verify_vartime(std::span<const uint8_t> msg, std::span<const uint8_t, SIG_BYTE_LEN> sig_bytes) const
+  {
+    return this->ppk.template verify<𝜈w, 𝜔, sig_bytes.size(), Binf, B22, raccoon_timing::variable_time_t>(msg, sig_bytes);
+  }
+};
+
 }
@@ -1,6 +1,8 @@
 #include "raccoon/raccoon192.hpp"
 #include "test_helper.hpp"
 #include <gtest/gtest.h>
+#include <latch>
+#include <thread>
 
 // Test Raccoon-192 "key generation -> signing -> verification" flow for random messages of given byte length.
 template<size_t d>
@@ -98,3 +100,1590 @@ TEST(RaccoonSign, Raccoon192Signing)
     test_raccoon192_signing<32>(mlen);
   }
 }
+
+// Test that Raccoon-192 signatures produced using a prepared secret key verify, for random messages of given byte length.
+template<size_t d>
+static void
+test_raccoon192_prepared_signing(const size_t mlen)
+{
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msg(mlen, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig_bytes);
+  auto msg_span = std::span<uint8_t>(msg);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+  prng.read(msg_span);
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+
+  auto prepared_skey = skey.prepare();
+
+  prepared_skey.sign(msg_span, sig_bytes_span);
+  ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+
+  // Prepared secret key can be refreshed and reused for signing again
+  prepared_skey.refresh();
+  prepared_skey.sign(msg_span, sig_bytes_span);
+  ASSERT_TRUE(prepared_skey.get_pkey().verify(msg_span, sig_bytes_span));
+
+  random_bitflip(sig_bytes_span, prng);
+  ASSERT_FALSE(pkey.verify(msg_span, sig_bytes_span));
+}
+
+TEST(RaccoonSign, Raccoon192PreparedSigning)
+{
+  constexpr size_t mlen = 32;
+
+  test_raccoon192_prepared_signing<1>(mlen);
+  test_raccoon192_prepared_signing<2>(mlen);
+  test_raccoon192_prepared_signing<4>(mlen);
+  test_raccoon192_prepared_signing<8>(mlen);
+  test_raccoon192_prepared_signing<16>(mlen);
+  test_raccoon192_prepared_signing<32>(mlen);
+}
+
+// Test that a prepared Raccoon-192 public key agrees with the public key it was prepared from, for both valid and tampered (message, signature) pairs.
+static void
+test_raccoon192_prepared_verification(const size_t mlen)
+{
+  constexpr size_t d = 1;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msg(mlen, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig_bytes);
+  auto msg_span = std::span<uint8_t>(msg);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+  prng.read(msg_span);
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+  auto prepared_pkey = raccoon192::raccoon192_prepared_pkey_t(pkey);
+
+  skey.sign(msg_span, sig_bytes_span);
+  ASSERT_TRUE(prepared_pkey.verify(msg_span, sig_bytes_span));
+
+  random_bitflip(msg_span, prng);
+  ASSERT_EQ(prepared_pkey.verify(msg_span, sig_bytes_span), pkey.verify(msg_span, sig_bytes_span));
+
+  random_bitflip(sig_bytes_span, prng);
+  ASSERT_FALSE(prepared_pkey.verify(msg_span, sig_bytes_span));
+  ASSERT_FALSE(pkey.verify(msg_span, sig_bytes_span));
+}
+
+TEST(RaccoonSign, Raccoon192PreparedVerification)
+{
+  constexpr size_t min_mlen = 0;
+  constexpr size_t max_mlen = 16;
+  constexpr size_t step_by = 4;
+
+  for (size_t mlen = min_mlen; mlen <= max_mlen; mlen += step_by) {
+    test_raccoon192_prepared_verification(mlen);
+  }
+}
+
+// Test Raccoon-192 offline/ online signing, where online signing consumes precomputed commitments from a pool, which is filled either synchronously or
+// by a background producer thread.
+template<size_t d>
+static void
+test_raccoon192_offline_online_signing(const size_t mlen)
+{
+  constexpr size_t pool_capacity = 2;
+  constexpr size_t num_msgs = 4;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msg(mlen, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig_bytes);
+  auto msg_span = std::span<uint8_t>(msg);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+  auto prepared_skey = skey.prepare();
+
+  raccoon192::raccoon192_presig_pool_t<d> pool(pool_capacity);
+
+  // Offline phase, filling the pool synchronously
+  prepared_skey.refill(pool);
+  ASSERT_EQ(pool.size(), pool_capacity);
+
+  // Online phase, each signing attempt consumes one presignature, never putting it back
+  prng.read(msg_span);
+  prepared_skey.sign(msg_span, sig_bytes_span, pool);
+  ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+  ASSERT_LT(pool.size(), pool_capacity);
+
+  // Online signing keeps working, even when pool runs dry
+  for (size_t i = 0; i < num_msgs; i++) {
+    prng.read(msg_span);
+    prepared_skey.sign(msg_span, sig_bytes_span, pool);
+    ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+  }
+
+  // Offline phase, filling the pool from a background producer thread
+  {
+    std::jthread producer([&](std::stop_token stoken) { prepared_skey.produce(pool, stoken); });
+
+    for (size_t i = 0; i < num_msgs; i++) {
+      prng.read(msg_span);
+      prepared_skey.sign(msg_span, sig_bytes_span, pool);
+      ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+    }
+  }
+
+  ASSERT_LE(pool.size(), pool_capacity);
+
+  // Pool filled by one key is rejected by another key, of the same parameter set, as its commitments were computed under another matrix A
+  prng.read(seed_span);
+  auto other_skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto other_prepared_skey = other_skey.prepare();
+
+  prepared_skey.refill(pool);
+  const size_t num_presigs = pool.size();
+
+  EXPECT_THROW(other_prepared_skey.sign(msg_span, sig_bytes_span, pool), std::invalid_argument);
+  EXPECT_EQ(pool.size(), num_presigs - 1);
+
+  prepared_skey.sign(msg_span, sig_bytes_span, pool);
+  ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+}
+
+TEST(RaccoonSign, Raccoon192OfflineOnlineSigning)
+{
+  constexpr size_t mlen = 32;
+
+  test_raccoon192_offline_online_signing<1>(mlen);
+  test_raccoon192_offline_online_signing<2>(mlen);
+  test_raccoon192_offline_online_signing<4>(mlen);
+  test_raccoon192_offline_online_signing<8>(mlen);
+  test_raccoon192_offline_online_signing<16>(mlen);
+  test_raccoon192_offline_online_signing<32>(mlen);
+}
+
+// Test that Raccoon-192 signatures, produced by speculatively running signing attempts in parallel, on a thread pool, verify, for a range of number of
+// parallel attempts, including the degenerate case of a single attempt, running on the calling thread.
+template<size_t d>
+static void
+test_raccoon192_speculative_signing(const size_t mlen)
+{
+  constexpr size_t max_num_attempts = 4;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msg(mlen, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig_bytes);
+  auto msg_span = std::span<uint8_t>(msg);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+  auto prepared_skey = skey.prepare();
+
+  raccoon_thread_pool::thread_pool_t pool(max_num_attempts - 1);
+
+  for (size_t num_attempts = 1; num_attempts <= max_num_attempts; num_attempts++) {
+    const raccoon_sign_policy::speculative_t policy{ pool, num_attempts };
+
+    prng.read(msg_span);
+    skey.sign(msg_span, sig_bytes_span, policy);
+    ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+
+    prng.read(msg_span);
+    prepared_skey.sign(msg_span, sig_bytes_span, policy);
+    ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+  }
+
+  // Signing from each worker of the same, hence saturated, pool must not deadlock
+  const raccoon_sign_policy::speculative_t policy{ pool, max_num_attempts };
+
+  std::vector<std::vector<uint8_t>> worker_sigs(pool.num_threads(), std::vector<uint8_t>(raccoon192::SIG_BYTE_LEN, 0));
+  std::latch finished(static_cast<std::ptrdiff_t>(pool.num_threads()));
+
+  for (auto& worker_sig : worker_sigs) {
+    pool.submit([&] {
+      skey.sign(msg_span, std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(worker_sig), policy);
+      finished.count_down();
+    });
+  }
+  finished.wait();
+
+  for (auto& worker_sig : worker_sigs) {
+    ASSERT_TRUE(pkey.verify(msg_span, std::span<const uint8_t, raccoon192::SIG_BYTE_LEN>(worker_sig)));
+  }
+}
+
+TEST(RaccoonSign, Raccoon192SpeculativeSigning)
+{
+  constexpr size_t mlen = 32;
+
+  test_raccoon192_speculative_signing<1>(mlen);
+  test_raccoon192_speculative_signing<2>(mlen);
+  test_raccoon192_speculative_signing<4>(mlen);
+  test_raccoon192_speculative_signing<8>(mlen);
+  test_raccoon192_speculative_signing<16>(mlen);
+  test_raccoon192_speculative_signing<32>(mlen);
+}
+
+// Test that a batch of Raccoon-192 signatures, produced both on the calling thread and spread across a thread pool, verifies, s.t. each signature is
+// written to its own slot of the output buffer, and a mis-sized output buffer is rejected.
+template<size_t d>
+static void
+test_raccoon192_batch_signing(const size_t mlen)
+{
+  constexpr size_t num_msgs = 5;
+  constexpr size_t num_threads = 2;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sigs_bytes(num_msgs * raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<std::vector<uint8_t>> msgs(num_msgs);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+
+  std::vector<std::span<const uint8_t>> msg_spans{};
+  for (size_t i = 0; i < num_msgs; i++) {
+    // Messages of varying length, including an empty one
+    msgs[i].resize(mlen * i);
+    prng.read(msgs[i]);
+    msg_spans.emplace_back(msgs[i]);
+  }
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+  auto prepared_skey = skey.prepare();
+
+  const auto verify_batch = [&]() {
+    for (size_t i = 0; i < num_msgs; i++) {
+      auto sig_bytes_span = std::span(sigs_bytes).subspan(i * raccoon192::SIG_BYTE_LEN).template first<raccoon192::SIG_BYTE_LEN>();
+      ASSERT_TRUE(pkey.verify(msg_spans[i], sig_bytes_span));
+    }
+  };
+
+  skey.sign_batch(msg_spans, sigs_bytes);
+  verify_batch();
+
+  raccoon_thread_pool::thread_pool_t pool(num_threads);
+  std::fill(sigs_bytes.begin(), sigs_bytes.end(), 0);
+
+  prepared_skey.sign_batch(msg_spans, sigs_bytes, &pool);
+  verify_batch();
+
+  // Batch signing from every worker of the pool at once signs on the calling worker, instead of waiting on the saturated pool
+  std::vector<std::vector<uint8_t>> nested_sigs_bytes(num_threads, std::vector<uint8_t>(sigs_bytes.size(), 0));
+  std::latch nested_done(static_cast<std::ptrdiff_t>(num_threads));
+
+  for (size_t i = 0; i < num_threads; i++) {
+    pool.submit([&, i] {
+      prepared_skey.sign_batch(msg_spans, nested_sigs_bytes[i], &pool);
+      nested_done.count_down();
+    });
+  }
+  nested_done.wait();
+
+  for (const auto& nested_sig_bytes : nested_sigs_bytes) {
+    std::copy(nested_sig_bytes.begin(), nested_sig_bytes.end(), sigs_bytes.begin());
+    verify_batch();
+  }
+
+  // Empty batch is a no-op
+  prepared_skey.sign_batch({}, {}, &pool);
+
+  EXPECT_THROW(prepared_skey.sign_batch(msg_spans, std::span(sigs_bytes).first(raccoon192::SIG_BYTE_LEN)), std::invalid_argument);
+}
+
+TEST(RaccoonSign, Raccoon192BatchSigning)
+{
+  constexpr size_t mlen = 32;
+
+  test_raccoon192_batch_signing<1>(mlen);
+  test_raccoon192_batch_signing<2>(mlen);
+  test_raccoon192_batch_signing<4>(mlen);
+  test_raccoon192_batch_signing<8>(mlen);
+  test_raccoon192_batch_signing<16>(mlen);
+  test_raccoon192_batch_signing<32>(mlen);
+}
+
+// Test that Raccoon-192 streaming signer and verifier, absorbing the message in chunks of varying length, interoperate with the one-shot API, s.t.
+// verification outcome, both for valid and tampered signatures, is same as that of one-shot verification.
+template<size_t d>
+static void
+test_raccoon192_streaming_signing(const size_t mlen)
+{
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msg(mlen, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig_bytes);
+  auto msg_span = std::span<const uint8_t>(msg);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+  prng.read(msg);
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+  auto prepared_skey = skey.prepare();
+  auto prepared_pkey = raccoon192::raccoon192_prepared_pkey_t(pkey);
+
+  // Absorbs the message in chunks of length 0, 1, 2, ..., until it is exhausted
+  const auto stream_in = [&](auto& streamer) {
+    size_t off = 0;
+    for (size_t chunk_len = 0; off < msg_span.size(); chunk_len++) {
+      const size_t len = std::min(chunk_len, msg_span.size() - off);
+      streamer.update(msg_span.subspan(off, len));
+      off += len;
+    }
+  };
+
+  const auto stream_verify = [&]() {
+    raccoon192::raccoon192_verifier_t verifier(prepared_pkey);
+    stream_in(verifier);
+    return verifier.final_verify(sig_bytes_span);
+  };
+
+  // Streaming signing -> one-shot and streaming verification
+  {
+    raccoon192::raccoon192_signer_t<d> signer(prepared_skey);
+    stream_in(signer);
+    signer.final_sign(sig_bytes_span);
+  }
+
+  ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+  ASSERT_TRUE(stream_verify());
+
+  // One-shot signing -> streaming verification
+  skey.sign(msg_span, sig_bytes_span);
+  ASSERT_TRUE(stream_verify());
+
+  // Tampered signature is rejected by both
+  sig_bytes_span[sig_bytes_span.size() / 2] ^= 0x01;
+  ASSERT_EQ(stream_verify(), pkey.verify(msg_span, sig_bytes_span));
+  ASSERT_FALSE(stream_verify());
+}
+
+TEST(RaccoonSign, Raccoon192StreamingSigning)
+{
+  constexpr size_t mlen = 1024;
+
+  test_raccoon192_streaming_signing<1>(mlen);
+  test_raccoon192_streaming_signing<2>(mlen);
+  test_raccoon192_streaming_signing<4>(mlen);
+  test_raccoon192_streaming_signing<8>(mlen);
+  test_raccoon192_streaming_signing<16>(mlen);
+  test_raccoon192_streaming_signing<32>(mlen);
+}
+
+// Test that Raccoon-192 signing and verification, given externally computed message digest 𝜇, interoperate with the regular message based API.
+template<size_t d>
+static void
+test_raccoon192_external_mu_signing(const size_t mlen)
+{
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msg(mlen, 0);
+  std::array<uint8_t, raccoon192::MU_BYTE_LEN> mu{};
+  std::array<uint8_t, raccoon192::MU_BYTE_LEN> streamed_mu{};
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig_bytes);
+  auto msg_span = std::span<const uint8_t>(msg);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+  prng.read(msg);
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+  auto prepared_skey = skey.prepare();
+  auto prepared_pkey = raccoon192::raccoon192_prepared_pkey_t(pkey);
+
+  // 𝜇, computed in one go and in chunks, using regular or prepared public key, must be same
+  raccoon192::raccoon192_mu_hasher_t::compute(pkey, msg_span, mu);
+
+  raccoon192::raccoon192_mu_hasher_t hasher(prepared_pkey);
+  hasher.update(msg_span.first(mlen / 2));
+  hasher.update(msg_span.subspan(mlen / 2));
+  hasher.finalize(streamed_mu);
+
+  ASSERT_EQ(mu, streamed_mu);
+
+  skey.sign_mu(mu, sig_bytes_span);
+  ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+  ASSERT_TRUE(prepared_pkey.verify_mu(mu, sig_bytes_span));
+
+  prepared_skey.sign_mu(mu, sig_bytes_span);
+  ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+  ASSERT_TRUE(pkey.verify_mu(mu, sig_bytes_span));
+
+  skey.sign(msg_span, sig_bytes_span);
+  ASSERT_TRUE(pkey.verify_mu(mu, sig_bytes_span));
+
+  // Signature doesn't verify against 𝜇 of some other message
+  mu[0] ^= 0x01;
+  ASSERT_FALSE(pkey.verify_mu(mu, sig_bytes_span));
+  ASSERT_FALSE(prepared_pkey.verify_mu(mu, sig_bytes_span));
+}
+
+TEST(RaccoonSign, Raccoon192ExternalMuSigning)
+{
+  constexpr size_t mlen = 32;
+
+  test_raccoon192_external_mu_signing<1>(mlen);
+  test_raccoon192_external_mu_signing<2>(mlen);
+  test_raccoon192_external_mu_signing<4>(mlen);
+  test_raccoon192_external_mu_signing<8>(mlen);
+  test_raccoon192_external_mu_signing<16>(mlen);
+  test_raccoon192_external_mu_signing<32>(mlen);
+}
+
+// Test that Raccoon-192 signing, refreshing the shares of the secret key in place, keeps producing valid signatures, across many signing calls, both
+// when called from a single thread, and when a pooled secret key is called concurrently from many threads.
+template<size_t d>
+static void
+test_raccoon192_in_place_signing(const size_t mlen)
+{
+  constexpr size_t num_msgs = 3;
+  constexpr size_t num_threads = 3;
+  constexpr size_t num_share_sets = 2;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msg(mlen, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig_bytes);
+  auto msg_span = std::span<uint8_t>(msg);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+  auto prepared_skey = skey.prepare();
+  auto pooled_skey = skey.prepare_pooled(num_share_sets);
+
+  ASSERT_EQ(pooled_skey->num_share_sets(), num_share_sets);
+
+  for (size_t i = 0; i < num_msgs; i++) {
+    prng.read(msg_span);
+    skey.sign_in_place(msg_span, sig_bytes_span);
+    ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+
+    prng.read(msg_span);
+    prepared_skey.sign_in_place(msg_span, sig_bytes_span);
+    ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+  }
+
+  // More threads than share sets, so that some signing calls have to wait for a share set
+  std::vector<std::vector<uint8_t>> thread_msgs(num_threads, std::vector<uint8_t>(mlen, 0));
+  std::vector<std::vector<uint8_t>> thread_sigs(num_threads, std::vector<uint8_t>(raccoon192::SIG_BYTE_LEN, 0));
+
+  for (auto& thread_msg : thread_msgs) {
+    prng.read(thread_msg);
+  }
+
+  {
+    // Signing needs more stack than default stack size of a thread, for higher number of shares, which thread pool workers do have
+    raccoon_thread_pool::thread_pool_t signers(num_threads);
+    std::latch finished(num_threads);
+
+    for (size_t i = 0; i < num_threads; i++) {
+      signers.submit([&, i] {
+        auto thread_sig_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(thread_sigs[i]);
+        pooled_skey->sign(thread_msgs[i], thread_sig_span);
+        finished.count_down();
+      });
+    }
+
+    finished.wait();
+  }
+
+  for (size_t i = 0; i < num_threads; i++) {
+    auto thread_sig_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(thread_sigs[i]);
+    ASSERT_TRUE(pkey.verify(thread_msgs[i], thread_sig_span));
+  }
+}
+
+TEST(RaccoonSign, Raccoon192InPlaceSigning)
+{
+  constexpr size_t mlen = 32;
+
+  test_raccoon192_in_place_signing<1>(mlen);
+  test_raccoon192_in_place_signing<2>(mlen);
+  test_raccoon192_in_place_signing<4>(mlen);
+  test_raccoon192_in_place_signing<8>(mlen);
+  test_raccoon192_in_place_signing<16>(mlen);
+  test_raccoon192_in_place_signing<32>(mlen);
+}
+
+// Test Raccoon-192 key generation, signing and verification, while keeping large intermediates in heap allocated, caller owned workspaces, which are
+// reused across calls, ensuring that they interoperate with the regular API.
+template<size_t d>
+static void
+test_raccoon192_workspace_signing(const size_t mlen)
+{
+  constexpr size_t num_msgs = 2;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msg(mlen, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig_bytes);
+  auto msg_span = std::span<uint8_t>(msg);
+
+  auto keygen_ws = std::make_unique<raccoon192::raccoon192_keygen_workspace_t<d>>();
+  auto sign_ws = std::make_unique<raccoon192::raccoon192_sign_workspace_t<d>>();
+  auto verify_ws = std::make_unique<raccoon192::raccoon192_verify_workspace_t>();
+
+  static_assert(raccoon192::raccoon192_sign_workspace_t<d>::get_byte_len() >= sizeof(raccoon192::raccoon192_sign_workspace_t<d>));
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(sign_ws.get()) % raccoon_workspace::ALIGNMENT, 0ul);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span, *keygen_ws);
+  auto pkey = skey.get_pkey();
+
+  keygen_ws->clear();
+
+  auto prepared_skey = skey.prepare();
+
+  for (size_t i = 0; i < num_msgs; i++) {
+    prng.read(msg_span);
+
+    skey.sign(msg_span, sig_bytes_span, *sign_ws);
+    ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+    ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span, *verify_ws));
+
+    prepared_skey.sign(msg_span, sig_bytes_span, *sign_ws);
+    ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span, *verify_ws));
+
+    random_bitflip(sig_bytes_span, prng);
+    ASSERT_EQ(pkey.verify(msg_span, sig_bytes_span, *verify_ws), pkey.verify(msg_span, sig_bytes_span));
+  }
+
+  sign_ws->clear();
+}
+
+TEST(RaccoonSign, Raccoon192WorkspaceSigning)
+{
+  constexpr size_t mlen = 32;
+
+  test_raccoon192_workspace_signing<1>(mlen);
+  test_raccoon192_workspace_signing<2>(mlen);
+  test_raccoon192_workspace_signing<4>(mlen);
+  test_raccoon192_workspace_signing<8>(mlen);
+  test_raccoon192_workspace_signing<16>(mlen);
+  test_raccoon192_workspace_signing<32>(mlen);
+}
+
+// Signs each message asynchronously, verifies the signature asynchronously and ensures that the awaiting coroutine is resumed on the completion executor,
+// each time, returning boolean truth value, if all of them were successful.
+template<size_t d>
+static raccoon_async::task_t<bool>
+raccoon192_async_sign_then_verify(const raccoon192::raccoon192_async_signer_t<d>& signer,
+                                  const raccoon192::raccoon192_async_verifier_t& verifier,
+                                  std::span<const std::vector<uint8_t>> msgs,
+                                  raccoon_thread_pool::thread_pool_t& completion,
+                                  const std::thread::id completion_thread_id)
+{
+  bool is_valid = true;
+
+  for (const auto& msg : msgs) {
+    const auto sig_bytes = co_await signer.sign_async(msg, completion);
+    is_valid &= std::this_thread::get_id() == completion_thread_id;
+
+    is_valid &= co_await verifier.verify_async(msg, sig_bytes, completion);
+    is_valid &= std::this_thread::get_id() == completion_thread_id;
+
+    auto tampered_sig_bytes = sig_bytes;
+    tampered_sig_bytes[tampered_sig_bytes.size() / 2] ^= 0x01;
+    is_valid &= !(co_await verifier.verify_async(msg, tampered_sig_bytes));
+  }
+
+  co_return is_valid;
+}
+
+// Test that Raccoon-192 asynchronous, coroutine based signing and verification interoperate with the regular API, and that completion is delivered on
+// the caller chosen executor.
+template<size_t d>
+static void
+test_raccoon192_async_signing(const size_t mlen)
+{
+  constexpr size_t num_msgs = 2;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<std::vector<uint8_t>> msgs(num_msgs, std::vector<uint8_t>(mlen, 0));
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+  for (auto& msg : msgs) {
+    prng.read(msg);
+  }
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+  auto prepared_skey = skey.prepare();
+  auto prepared_pkey = raccoon192::raccoon192_prepared_pkey_t(pkey);
+
+  raccoon_thread_pool::thread_pool_t workers(2);
+  raccoon_thread_pool::thread_pool_t completion(1);
+
+  std::thread::id completion_thread_id{};
+  std::latch known(1);
+  completion.submit([&] {
+    completion_thread_id = std::this_thread::get_id();
+    known.count_down();
+  });
+  known.wait();
+
+  raccoon192::raccoon192_async_signer_t<d> signer(prepared_skey, workers);
+  raccoon192::raccoon192_async_verifier_t verifier(prepared_pkey, workers);
+
+  ASSERT_TRUE(raccoon_async::sync_wait(raccoon192_async_sign_then_verify<d>(signer, verifier, msgs, completion, completion_thread_id)));
+
+  // Asynchronously produced signature, using the default executor, is accepted by the regular verifier
+  raccoon192::raccoon192_async_signer_t<d> default_signer(prepared_skey);
+  auto sig_bytes = raccoon_async::sync_wait(default_signer.sign_async(msgs[0]));
+  ASSERT_TRUE(pkey.verify(msgs[0], sig_bytes));
+}
+
+TEST(RaccoonSign, Raccoon192AsyncSigning)
+{
+  constexpr size_t mlen = 32;
+
+  test_raccoon192_async_signing<1>(mlen);
+  test_raccoon192_async_signing<2>(mlen);
+  test_raccoon192_async_signing<4>(mlen);
+  test_raccoon192_async_signing<8>(mlen);
+  test_raccoon192_async_signing<16>(mlen);
+  test_raccoon192_async_signing<32>(mlen);
+}
+
+// Test that Raccoon-192 secret key, serving concurrent signers, while its shares are refreshed in the background, produces valid signatures, across epochs.
+template<size_t d>
+static void
+test_raccoon192_epoch_signing(const size_t mlen)
+{
+  constexpr size_t num_threads = 3;
+  constexpr size_t num_msgs_per_thread = 2;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+
+  // Refreshes shares once every two signatures, along with once every millisecond
+  auto epoch_skey = skey.prepare_epoch({ .num_sigs = 2, .interval = std::chrono::milliseconds(1) });
+
+  std::vector<std::vector<uint8_t>> thread_msgs(num_threads * num_msgs_per_thread, std::vector<uint8_t>(mlen, 0));
+  std::vector<std::vector<uint8_t>> thread_sigs(num_threads * num_msgs_per_thread, std::vector<uint8_t>(raccoon192::SIG_BYTE_LEN, 0));
+
+  for (auto& thread_msg : thread_msgs) {
+    prng.read(thread_msg);
+  }
+
+  {
+    raccoon_thread_pool::thread_pool_t signers(num_threads);
+    std::latch finished(num_threads);
+
+    for (size_t i = 0; i < num_threads; i++) {
+      signers.submit([&, i] {
+        for (size_t j = i * num_msgs_per_thread; j < (i + 1) * num_msgs_per_thread; j++) {
+          auto thread_sig_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(thread_sigs[j]);
+          epoch_skey->sign(thread_msgs[j], thread_sig_span);
+        }
+        finished.count_down();
+      });
+    }
+
+    finished.wait();
+  }
+
+  for (size_t i = 0; i < thread_msgs.size(); i++) {
+    auto thread_sig_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(thread_sigs[i]);
+    ASSERT_TRUE(pkey.verify(thread_msgs[i], thread_sig_span));
+  }
+
+  // Shares keep getting refreshed in the background, while signatures remain valid
+  const auto epoch = epoch_skey->epoch();
+  while (epoch_skey->epoch() == epoch) {
+    std::this_thread::yield();
+  }
+
+  std::vector<uint8_t> sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  auto sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig_bytes);
+
+  epoch_skey->sign(thread_msgs[0], sig_bytes_span);
+  ASSERT_TRUE(pkey.verify(thread_msgs[0], sig_bytes_span));
+
+  // Same, using caller supplied workspace, reused across calls and epochs
+  auto ws = std::make_unique<raccoon192::raccoon192_epoch_sign_workspace_t<d>>();
+  for (size_t i = 0; i < 2; i++) {
+    epoch_skey->sign(thread_msgs[1], sig_bytes_span, *ws);
+    ASSERT_TRUE(pkey.verify(thread_msgs[1], sig_bytes_span));
+
+    epoch_skey->refresh();
+  }
+
+  // Default cadence keeps refreshing shares, while disabling both of its triggers is rejected
+  auto default_epoch_skey = skey.prepare_epoch({});
+  default_epoch_skey->sign(thread_msgs[0], sig_bytes_span);
+  ASSERT_TRUE(pkey.verify(thread_msgs[0], sig_bytes_span));
+
+  // Workspace, holding shares of another key, takes a fresh copy of shares of this key, instead of signing using the former
+  default_epoch_skey->sign(thread_msgs[1], sig_bytes_span, *ws);
+  ASSERT_TRUE(pkey.verify(thread_msgs[1], sig_bytes_span));
+
+  EXPECT_THROW(skey.prepare_epoch({ .num_sigs = 0, .interval = std::chrono::milliseconds(0) }), std::invalid_argument);
+}
+
+TEST(RaccoonSign, Raccoon192EpochSigning)
+{
+  constexpr size_t mlen = 32;
+
+  test_raccoon192_epoch_signing<1>(mlen);
+  test_raccoon192_epoch_signing<2>(mlen);
+  test_raccoon192_epoch_signing<4>(mlen);
+  test_raccoon192_epoch_signing<8>(mlen);
+  test_raccoon192_epoch_signing<16>(mlen);
+  test_raccoon192_epoch_signing<32>(mlen);
+}
+
+// Test that Raccoon-192 batch verification, spanning more than one block of signatures, reports the same outcome as one-by-one verification, for each
+// signature of the batch, be it valid or tampered.
+template<size_t d>
+static void
+test_raccoon192_batch_verification(const size_t mlen)
+{
+  constexpr size_t num_msgs = 2 * raccoon_pkey::prepared_pkey_t<raccoon192::𝜅, raccoon192::k, raccoon192::l, raccoon192::𝜈t>::BATCH_BLOCK_LEN + 3;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sigs_bytes(num_msgs * raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<std::vector<uint8_t>> msgs(num_msgs, std::vector<uint8_t>(mlen, 0));
+  std::array<bool, num_msgs> results{};
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+
+  std::vector<std::span<const uint8_t>> msg_spans{};
+  for (auto& msg : msgs) {
+    prng.read(msg);
+    msg_spans.emplace_back(msg);
+  }
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+  auto prepared_pkey = raccoon192::raccoon192_prepared_pkey_t(pkey);
+
+  skey.sign_batch(msg_spans, sigs_bytes);
+
+  ASSERT_TRUE(prepared_pkey.verify_batch(msg_spans, sigs_bytes, results));
+  ASSERT_TRUE(std::all_of(results.begin(), results.end(), [](const bool is_verified) { return is_verified; }));
+
+  // Tamper with a few signatures, across blocks, and one of the messages
+  const auto sig_at = [&](const size_t i) { return std::span(sigs_bytes).subspan(i * raccoon192::SIG_BYTE_LEN).template first<raccoon192::SIG_BYTE_LEN>(); };
+
+  random_bitflip(sig_at(1), prng);
+  random_bitflip(sig_at(num_msgs / 2), prng);
+  msgs[num_msgs - 1][0] ^= 0x01;
+
+  ASSERT_FALSE(prepared_pkey.verify_batch(msg_spans, sigs_bytes, results));
+  for (size_t i = 0; i < num_msgs; i++) {
+    ASSERT_EQ(results[i], pkey.verify(msg_spans[i], sig_at(i)));
+  }
+  ASSERT_FALSE(results[num_msgs - 1]);
+
+  // Empty batch is trivially valid
+  ASSERT_TRUE(prepared_pkey.verify_batch({}, {}, {}));
+
+  EXPECT_THROW(prepared_pkey.verify_batch(msg_spans, std::span(sigs_bytes).first(raccoon192::SIG_BYTE_LEN), results), std::invalid_argument);
+  EXPECT_THROW(prepared_pkey.verify_batch(msg_spans, sigs_bytes, std::span(results).first(1)), std::invalid_argument);
+}
+
+TEST(RaccoonSign, Raccoon192BatchVerification)
+{
+  constexpr size_t mlen = 32;
+
+  test_raccoon192_batch_verification<1>(mlen);
+  test_raccoon192_batch_verification<2>(mlen);
+  test_raccoon192_batch_verification<4>(mlen);
+  test_raccoon192_batch_verification<8>(mlen);
+  test_raccoon192_batch_verification<16>(mlen);
+  test_raccoon192_batch_verification<32>(mlen);
+}
+
+// Test that Raccoon-192 verification pool, given jobs under many public keys, interleaved, resolves each of them to the same outcome as one-by-one
+// verification, both through futures and callbacks.
+template<size_t d>
+static void
+test_raccoon192_verify_pool(const size_t mlen)
+{
+  constexpr size_t num_keys = 3;
+  constexpr size_t num_msgs_per_key = 4;
+  constexpr size_t num_threads = 3;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+
+  prng::prng_t prng;
+
+  std::vector<raccoon192::raccoon192_pkey_t> pkeys{};
+  std::vector<std::vector<uint8_t>> msgs{};
+  std::vector<std::vector<uint8_t>> sigs{};
+  std::vector<size_t> key_idx{};
+
+  for (size_t i = 0; i < num_keys; i++) {
+    prng.read(seed_span);
+
+    auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+    pkeys.push_back(skey.get_pkey());
+
+    for (size_t j = 0; j < num_msgs_per_key; j++) {
+      std::vector<uint8_t> msg(mlen, 0);
+      std::vector<uint8_t> sig(raccoon192::SIG_BYTE_LEN, 0);
+
+      prng.read(msg);
+      skey.sign(msg, std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig));
+
+      msgs.push_back(std::move(msg));
+      sigs.push_back(std::move(sig));
+      key_idx.push_back(i);
+    }
+  }
+
+  // Tamper with one signature, use a wrong key for one and truncate another one
+  random_bitflip(sigs[1], prng);
+  key_idx[num_msgs_per_key] = 0;
+  sigs[sigs.size() - 1].pop_back();
+
+  const auto expected = [&](const size_t i) {
+    if (sigs[i].size() != raccoon192::SIG_BYTE_LEN) {
+      return false;
+    }
+    return pkeys[key_idx[i]].verify(msgs[i], std::span<const uint8_t, raccoon192::SIG_BYTE_LEN>(sigs[i]));
+  };
+
+  raccoon192::raccoon192_verify_pool_t pool(num_threads);
+  ASSERT_EQ(pool.num_threads(), num_threads);
+
+  // Interleave jobs across keys, so that workers keep switching between them
+  std::vector<std::pair<size_t, std::future<bool>>> futures{};
+  for (size_t j = 0; j < num_msgs_per_key; j++) {
+    for (size_t i = 0; i < num_keys; i++) {
+      const size_t idx = i * num_msgs_per_key + j;
+      futures.emplace_back(idx, pool.submit(pkeys[key_idx[idx]], msgs[idx], sigs[idx]));
+    }
+  }
+
+  for (auto& [idx, future] : futures) {
+    ASSERT_EQ(future.get(), expected(idx));
+  }
+
+  std::vector<uint8_t> outcomes(msgs.size(), 0);
+  std::latch finished(static_cast<std::ptrdiff_t>(msgs.size()));
+
+  for (size_t idx = 0; idx < msgs.size(); idx++) {
+    pool.submit(pkeys[key_idx[idx]], msgs[idx], sigs[idx], [&, idx](const bool is_verified) {
+      outcomes[idx] = static_cast<uint8_t>(is_verified) + 1;
+      finished.count_down();
+    });
+  }
+
+  finished.wait();
+  for (size_t idx = 0; idx < msgs.size(); idx++) {
+    ASSERT_EQ(outcomes[idx], static_cast<uint8_t>(expected(idx)) + 1);
+  }
+
+  ASSERT_FALSE(expected(num_msgs_per_key));
+  ASSERT_FALSE(expected(msgs.size() - 1));
+}
+
+TEST(RaccoonSign, Raccoon192VerifyPool)
+{
+  constexpr size_t mlen = 32;
+
+  test_raccoon192_verify_pool<1>(mlen);
+  test_raccoon192_verify_pool<2>(mlen);
+  test_raccoon192_verify_pool<4>(mlen);
+  test_raccoon192_verify_pool<8>(mlen);
+  test_raccoon192_verify_pool<16>(mlen);
+  test_raccoon192_verify_pool<32>(mlen);
+}
+
+// Test that variable-time verification of Raccoon-192 signatures, using either a public key or a prepared one, agrees with constant-time verification, for
+// valid, tampered, out of bounds and random (message, signature) pairs.
+static void
+test_raccoon192_vartime_verification(const size_t mlen)
+{
+  constexpr size_t d = 1;
+  constexpr size_t num_tamperings = 16;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> tampered_sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msg(mlen, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig_bytes);
+  auto tampered_sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(tampered_sig_bytes);
+  auto msg_span = std::span<uint8_t>(msg);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+  prng.read(msg_span);
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+  auto prepared_pkey = raccoon192::raccoon192_prepared_pkey_t(pkey);
+
+  // Returns outcome of constant-time verification, after checking that variable-time verification agrees with it
+  const auto verify = [&](std::span<const uint8_t> msg, std::span<const uint8_t, raccoon192::SIG_BYTE_LEN> sig) {
+    const bool expected = pkey.verify(msg, sig);
+
+    EXPECT_EQ(pkey.verify_vartime(msg, sig), expected);
+    EXPECT_EQ(prepared_pkey.verify_vartime(msg, sig), expected);
+
+    return expected;
+  };
+
+  skey.sign(msg_span, sig_bytes_span);
+  ASSERT_TRUE(verify(msg_span, sig_bytes_span));
+
+  for (size_t i = 0; i < num_tamperings; i++) {
+    std::copy(sig_bytes.begin(), sig_bytes.end(), tampered_sig_bytes.begin());
+    random_bitflip(tampered_sig_bytes_span, prng);
+
+    verify(msg_span, tampered_sig_bytes_span);
+  }
+
+  // Decodable signature, whose hint vector exceeds infinity norm bound. A few coefficients of response vector are zeroed, so that it still fits.
+  using sig_t = raccoon_sig::sig_t<raccoon192::𝜅, raccoon192::k, raccoon192::l, raccoon192::𝜈w, raccoon192::SIG_BYTE_LEN>;
+
+  const auto sig = sig_t::from_bytes(sig_bytes_span).value();
+  auto h = sig.get_h();
+  auto z = sig.get_z();
+
+  h[0][0][0] = (raccoon192::Binf >> raccoon192::𝜈w) + 1;
+  for (size_t i = 0; i < 8; i++) {
+    z[0][0][i] = 0;
+  }
+
+  const auto oob_sig = sig_t(sig.get_c_hash(), h, z);
+  ASSERT_TRUE(oob_sig.to_bytes(tampered_sig_bytes_span));
+  ASSERT_FALSE(verify(msg_span, tampered_sig_bytes_span));
+
+  prng.read(tampered_sig_bytes_span);
+  ASSERT_FALSE(verify(msg_span, tampered_sig_bytes_span));
+
+  if (!msg.empty()) {
+    random_bitflip(msg_span, prng);
+    ASSERT_FALSE(verify(msg_span, sig_bytes_span));
+  }
+}
+
+TEST(RaccoonSign, Raccoon192VartimeVerification)
+{
+  constexpr size_t min_mlen = 0;
+  constexpr size_t max_mlen = 16;
+  constexpr size_t step_by = 4;
+
+  for (size_t mlen = min_mlen; mlen <= max_mlen; mlen += step_by) {
+    test_raccoon192_vartime_verification(mlen);
+  }
+}
+
+// Test that staged verification of Raccoon-192 signatures, using either a public key or a prepared one, rejects malformed signatures at the cheapest stage,
+// which can tell so, and that its outcome agrees with that of `verify`.
+static void
+test_raccoon192_staged_verification(const size_t mlen)
+{
+  constexpr size_t d = 1;
+  constexpr size_t num_tamperings = 16;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> tampered_sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msg(mlen, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig_bytes);
+  auto tampered_sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(tampered_sig_bytes);
+  auto msg_span = std::span<uint8_t>(msg);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+  prng.read(msg_span);
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+  auto prepared_pkey = raccoon192::raccoon192_prepared_pkey_t(pkey);
+
+  using stage_t = raccoon192::raccoon192_verify_stage_t;
+
+  // Returns the rejecting stage, after checking that both staged verifiers agree with each other and with `verify`
+  const auto verify_staged = [&](std::span<const uint8_t> msg, std::span<const uint8_t> sig) {
+    const auto report = pkey.verify_staged(msg, sig);
+    const auto prepared_report = prepared_pkey.verify_staged(msg, sig);
+
+    EXPECT_EQ(prepared_report.stage, report.stage);
+    if (sig.size() == raccoon192::SIG_BYTE_LEN) {
+      EXPECT_EQ(pkey.verify(msg, sig.first<raccoon192::SIG_BYTE_LEN>()), report.is_verified());
+    }
+
+    // Stages after the rejecting one are never run
+    for (size_t i = static_cast<size_t>(report.stage) + 1; i < report.cycles.size(); i++) {
+      EXPECT_EQ(report.cycles[i], 0u);
+      EXPECT_EQ(prepared_report.cycles[i], 0u);
+    }
+
+    return report.stage;
+  };
+
+  skey.sign(msg_span, sig_bytes_span);
+  ASSERT_EQ(verify_staged(msg_span, sig_bytes_span), stage_t::accepted);
+
+  // Truncated and over-long signatures
+  std::vector<uint8_t> long_sig_bytes(sig_bytes.begin(), sig_bytes.end());
+  long_sig_bytes.push_back(0);
+
+  ASSERT_EQ(verify_staged(msg_span, sig_bytes_span.first(raccoon192::SIG_BYTE_LEN - 1)), stage_t::size);
+  ASSERT_EQ(verify_staged(msg_span, std::span<const uint8_t>{}), stage_t::size);
+  ASSERT_EQ(verify_staged(msg_span, long_sig_bytes), stage_t::size);
+
+  // Over-long unary run, right after challenge hash
+  std::copy(sig_bytes.begin(), sig_bytes.end(), tampered_sig_bytes.begin());
+  std::fill_n(tampered_sig_bytes.begin() + raccoon192::MU_BYTE_LEN, 8, 0xff);
+  ASSERT_EQ(verify_staged(msg_span, tampered_sig_bytes_span), stage_t::decode);
+
+  // Decodable signature, whose hint vector exceeds infinity norm bound. A few coefficients of response vector are zeroed, so that it still fits.
+  using sig_t = raccoon_sig::sig_t<raccoon192::𝜅, raccoon192::k, raccoon192::l, raccoon192::𝜈w, raccoon192::SIG_BYTE_LEN>;
+
+  const auto sig = sig_t::from_bytes(sig_bytes_span).value();
+  auto h = sig.get_h();
+  auto z = sig.get_z();
+
+  h[0][0][0] = (raccoon192::Binf >> raccoon192::𝜈w) + 1;
+  for (size_t i = 0; i < 8; i++) {
+    z[0][0][i] = 0;
+  }
+
+  const auto oob_sig = sig_t(sig.get_c_hash(), h, z);
+  ASSERT_TRUE(oob_sig.to_bytes(tampered_sig_bytes_span));
+  ASSERT_EQ(verify_staged(msg_span, tampered_sig_bytes_span), stage_t::norms);
+
+  // Well-formed signature, with tampered challenge hash
+  std::copy(sig_bytes.begin(), sig_bytes.end(), tampered_sig_bytes.begin());
+  random_bitflip(tampered_sig_bytes_span.first<raccoon192::MU_BYTE_LEN>(), prng);
+  ASSERT_EQ(verify_staged(msg_span, tampered_sig_bytes_span), stage_t::commitment);
+
+  for (size_t i = 0; i < num_tamperings; i++) {
+    std::copy(sig_bytes.begin(), sig_bytes.end(), tampered_sig_bytes.begin());
+    random_bitflip(tampered_sig_bytes_span, prng);
+
+    ASSERT_NE(verify_staged(msg_span, tampered_sig_bytes_span), stage_t::accepted);
+  }
+
+  if (!msg.empty()) {
+    random_bitflip(msg_span, prng);
+    ASSERT_EQ(verify_staged(msg_span, sig_bytes_span), stage_t::commitment);
+  }
+}
+
+TEST(RaccoonSign, Raccoon192StagedVerification)
+{
+  constexpr size_t min_mlen = 0;
+  constexpr size_t max_mlen = 16;
+  constexpr size_t step_by = 4;
+
+  for (size_t mlen = min_mlen; mlen <= max_mlen; mlen += step_by) {
+    test_raccoon192_staged_verification(mlen);
+  }
+}
+
+// Test that streaming verification of Raccoon-192 signatures, which generates public matrix A one row at a time, agrees with `verify`, for valid,
+// tampered and random (message, signature) pairs.
+static void
+test_raccoon192_streaming_verification(const size_t mlen)
+{
+  constexpr size_t d = 1;
+  constexpr size_t num_tamperings = 16;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> tampered_sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msg(mlen, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig_bytes);
+  auto tampered_sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(tampered_sig_bytes);
+  auto msg_span = std::span<uint8_t>(msg);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+  prng.read(msg_span);
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+
+  // Returns outcome of streaming verification, after checking that it agrees with `verify`
+  const auto verify = [&](std::span<const uint8_t> msg, std::span<const uint8_t, raccoon192::SIG_BYTE_LEN> sig) {
+    const bool is_verified = pkey.verify_streaming(msg, sig);
+
+    EXPECT_EQ(pkey.verify(msg, sig), is_verified);
+    return is_verified;
+  };
+
+  skey.sign(msg_span, sig_bytes_span);
+  ASSERT_TRUE(verify(msg_span, sig_bytes_span));
+
+  for (size_t i = 0; i < num_tamperings; i++) {
+    std::copy(sig_bytes.begin(), sig_bytes.end(), tampered_sig_bytes.begin());
+    random_bitflip(tampered_sig_bytes_span, prng);
+
+    ASSERT_FALSE(verify(msg_span, tampered_sig_bytes_span));
+  }
+
+  prng.read(tampered_sig_bytes_span);
+  ASSERT_FALSE(verify(msg_span, tampered_sig_bytes_span));
+
+  if (!msg.empty()) {
+    random_bitflip(msg_span, prng);
+    ASSERT_FALSE(verify(msg_span, sig_bytes_span));
+  }
+}
+
+TEST(RaccoonSign, Raccoon192StreamingVerification)
+{
+  constexpr size_t min_mlen = 0;
+  constexpr size_t max_mlen = 16;
+  constexpr size_t step_by = 4;
+
+  for (size_t mlen = min_mlen; mlen <= max_mlen; mlen += step_by) {
+    test_raccoon192_streaming_verification(mlen);
+  }
+}
+
+// Test that Raccoon-192 verification cache answers repeated verifications of valid (public key, message, signature) triples from the cache, never caches
+// invalid ones, evicts least recently used entries and stays consistent, when shared by many threads.
+static void
+test_raccoon192_verify_cache(const size_t mlen)
+{
+  constexpr size_t d = 1;
+  constexpr size_t capacity = 4;
+  constexpr size_t num_msgs = capacity + 2;
+  constexpr size_t num_threads = 4;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<std::vector<uint8_t>> msgs(num_msgs, std::vector<uint8_t>(mlen, 0));
+  std::vector<std::vector<uint8_t>> sigs(num_msgs, std::vector<uint8_t>(raccoon192::SIG_BYTE_LEN, 0));
+  std::vector<uint8_t> tampered_sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto tampered_sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(tampered_sig_bytes);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+
+  auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+  auto pkey = skey.get_pkey();
+  auto prepared_pkey = raccoon192::raccoon192_prepared_pkey_t(pkey);
+
+  const auto sig_of = [&](const size_t i) { return std::span<const uint8_t, raccoon192::SIG_BYTE_LEN>(sigs[i]); };
+
+  for (size_t i = 0; i < num_msgs; i++) {
+    prng.read(msgs[i]);
+    skey.sign(msgs[i], std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sigs[i]));
+  }
+
+  // Single shard, so that LRU order is global
+  raccoon192::raccoon192_verify_cache_t cache(capacity, 1);
+  EXPECT_EQ(cache.capacity(), capacity);
+
+  ASSERT_TRUE(cache.verify(pkey, msgs[0], sig_of(0)));
+  ASSERT_TRUE(cache.verify(pkey, msgs[0], sig_of(0)));
+  ASSERT_TRUE(cache.verify(prepared_pkey, msgs[0], sig_of(0)));
+
+  auto stats = cache.stats();
+  EXPECT_EQ(stats.misses, 1u);
+  EXPECT_EQ(stats.hits, 2u);
+  EXPECT_EQ(cache.size(), 1u);
+
+  // Invalid signatures are never cached
+  std::copy(sigs[0].begin(), sigs[0].end(), tampered_sig_bytes.begin());
+  random_bitflip(tampered_sig_bytes_span, prng);
+
+  ASSERT_FALSE(cache.verify(pkey, msgs[0], tampered_sig_bytes_span));
+  ASSERT_FALSE(cache.verify(prepared_pkey, msgs[0], tampered_sig_bytes_span));
+  ASSERT_FALSE(cache.verify(pkey, msgs[1], sig_of(0)));
+
+  stats = cache.stats();
+  EXPECT_EQ(stats.misses, 4u);
+  EXPECT_EQ(stats.hits, 2u);
+  EXPECT_EQ(cache.size(), 1u);
+
+  // Fill the cache, touch the oldest entry and overflow it, s.t. the second oldest one gets evicted
+  for (size_t i = 1; i < capacity; i++) {
+    ASSERT_TRUE(cache.verify(prepared_pkey, msgs[i], sig_of(i)));
+  }
+  ASSERT_TRUE(cache.verify(prepared_pkey, msgs[0], sig_of(0)));
+  ASSERT_TRUE(cache.verify(prepared_pkey, msgs[capacity], sig_of(capacity)));
+
+  cache.reset_stats();
+  EXPECT_EQ(cache.size(), capacity);
+
+  ASSERT_TRUE(cache.verify(prepared_pkey, msgs[0], sig_of(0)));
+  EXPECT_EQ(cache.stats().hits, 1u);
+  EXPECT_EQ(cache.stats().evictions, 0u);
+
+  ASSERT_TRUE(cache.verify(prepared_pkey, msgs[1], sig_of(1)));
+  EXPECT_EQ(cache.stats().misses, 1u);
+  EXPECT_EQ(cache.stats().evictions, 1u);
+
+  // Many threads, sharing a sharded cache, each verifying all valid and tampered triples, a few times over
+  raccoon192::raccoon192_verify_cache_t shared_cache(capacity);
+  std::atomic<size_t> num_wrong{ 0 };
+
+  std::vector<std::thread> threads{};
+  for (size_t t = 0; t < num_threads; t++) {
+    threads.emplace_back([&] {
+      for (size_t round = 0; round < 2; round++) {
+        for (size_t i = 0; i < num_msgs; i++) {
+          num_wrong += !shared_cache.verify(prepared_pkey, msgs[i], sig_of(i));
+          num_wrong += shared_cache.verify(prepared_pkey, msgs[i], tampered_sig_bytes_span);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  stats = shared_cache.stats();
+  EXPECT_EQ(num_wrong.load(), 0u);
+  EXPECT_EQ(stats.hits + stats.misses, num_threads * 2 * 2 * num_msgs);
+  EXPECT_LE(shared_cache.size(), shared_cache.capacity());
+}
+
+TEST(RaccoonSign, Raccoon192VerifyCache)
+{
+  test_raccoon192_verify_cache(16);
+  test_raccoon192_verify_cache(32);
+}
+
+// Test that Raccoon-192 keys, generated under a shared public matrix, sign messages whose signatures verify both with the shared public matrix and with
+// an ordinary public key, while keys carrying some other seed are refused.
+static void
+test_raccoon192_shared_matrix_signing(const size_t mlen)
+{
+  constexpr size_t d = 2;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> other_seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<uint8_t> sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> other_sig_bytes(raccoon192::SIG_BYTE_LEN, 0);
+  std::vector<uint8_t> msg(mlen, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto other_seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(other_seed);
+  auto sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sig_bytes);
+  auto other_sig_bytes_span = std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(other_sig_bytes);
+  auto msg_span = std::span<uint8_t>(msg);
+
+  prng::prng_t prng;
+  prng.read(seed_span);
+  prng.read(other_seed_span);
+  prng.read(msg_span);
+
+  // Shared matrix is expanded only once, per seed
+  const auto A = raccoon192::raccoon192_shared_matrix_t::get(seed_span);
+  EXPECT_EQ(raccoon192::raccoon192_shared_matrix_t::get(seed_span), A);
+  EXPECT_NE(raccoon192::raccoon192_shared_matrix_t::get(other_seed_span), A);
+
+  // Matrix, no longer used by anyone, goes away, while it's expanded again on next request
+  const std::weak_ptr<const raccoon192::raccoon192_shared_matrix_t> released = raccoon192::raccoon192_shared_matrix_t::get(other_seed_span);
+  EXPECT_TRUE(released.expired());
+  EXPECT_TRUE(raccoon192::raccoon192_shared_matrix_t::get(other_seed_span)->is_expanded_from(other_seed_span));
+
+  auto skey = raccoon192::raccoon192_shared_skey_t<d>::generate(A);
+  auto other_skey = raccoon192::raccoon192_shared_skey_t<d>::generate(A);
+  auto pkey = skey.get_pkey();
+  auto other_pkey = other_skey.get_pkey();
+
+  skey.sign(msg_span, sig_bytes_span);
+  other_skey.sign(msg_span, other_sig_bytes_span);
+
+  ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+  ASSERT_TRUE(pkey.get_pkey().verify(msg_span, sig_bytes_span));
+  ASSERT_TRUE(other_pkey.verify(msg_span, other_sig_bytes_span));
+
+  // Keys share the matrix, not the secret
+  ASSERT_FALSE(pkey.verify(msg_span, other_sig_bytes_span));
+  ASSERT_FALSE(other_pkey.verify(msg_span, sig_bytes_span));
+
+  // Public key, round-tripped through its byte serialized form, is still bound to the shared matrix
+  std::vector<uint8_t> pkey_bytes(raccoon192::PKEY_BYTE_LEN, 0);
+  auto pkey_bytes_span = std::span<uint8_t, raccoon192::PKEY_BYTE_LEN>(pkey_bytes);
+
+  pkey.get_pkey().as_bytes(pkey_bytes_span);
+  ASSERT_TRUE(raccoon192::raccoon192_shared_pkey_t(A, pkey_bytes_span).verify(msg_span, sig_bytes_span));
+
+  // Ordinary keys, carrying their own seed, don't belong to the shared matrix
+  const auto spec_skey = raccoon192::raccoon192_skey_t<d>::generate(other_seed_span);
+  EXPECT_THROW(raccoon192::raccoon192_shared_pkey_t(A, spec_skey.get_pkey()), std::invalid_argument);
+  EXPECT_THROW(raccoon192::raccoon192_shared_skey_t<d>::generate(nullptr), std::invalid_argument);
+
+  skey.refresh();
+  skey.sign(msg_span, sig_bytes_span);
+  ASSERT_TRUE(pkey.verify(msg_span, sig_bytes_span));
+
+  if (!msg.empty()) {
+    random_bitflip(msg_span, prng);
+    ASSERT_FALSE(pkey.verify(msg_span, sig_bytes_span));
+  }
+}
+
+TEST(RaccoonSign, Raccoon192SharedMatrixSigning)
+{
+  constexpr size_t min_mlen = 0;
+  constexpr size_t max_mlen = 16;
+  constexpr size_t step_by = 4;
+
+  for (size_t mlen = min_mlen; mlen <= max_mlen; mlen += step_by) {
+    test_raccoon192_shared_matrix_signing(mlen);
+  }
+}
+
+// Test that Raccoon-192 public key registry verifies signatures under the public key registered under given identifier, keeping only a bounded number of
+// them prepared, while public keys get replaced, erased and looked up from many threads.
+static void
+test_raccoon192_pkey_registry(const size_t mlen)
+{
+  constexpr size_t d = 1;
+  constexpr size_t num_keys = 4;
+  constexpr size_t max_prepared = 2;
+  constexpr size_t num_threads = 4;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<std::vector<uint8_t>> pkeys_bytes(num_keys, std::vector<uint8_t>(raccoon192::PKEY_BYTE_LEN, 0));
+  std::vector<std::vector<uint8_t>> sigs(num_keys, std::vector<uint8_t>(raccoon192::SIG_BYTE_LEN, 0));
+  std::vector<uint8_t> msg(mlen, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto msg_span = std::span<uint8_t>(msg);
+
+  prng::prng_t prng;
+  prng.read(msg_span);
+
+  const auto pkey_of = [&](const size_t i) { return std::span<const uint8_t, raccoon192::PKEY_BYTE_LEN>(pkeys_bytes[i]); };
+  const auto sig_of = [&](const size_t i) { return std::span<const uint8_t, raccoon192::SIG_BYTE_LEN>(sigs[i]); };
+
+  for (size_t i = 0; i < num_keys; i++) {
+    prng.read(seed_span);
+
+    auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+    skey.get_pkey().as_bytes(std::span<uint8_t, raccoon192::PKEY_BYTE_LEN>(pkeys_bytes[i]));
+    skey.sign(msg_span, std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sigs[i]));
+  }
+
+  raccoon192::raccoon192_pkey_registry_t<uint64_t> registry(max_prepared);
+
+  for (size_t i = 0; i < num_keys; i++) {
+    ASSERT_TRUE(registry.insert(i, pkey_of(i)));
+  }
+  ASSERT_FALSE(registry.insert(0, pkey_of(0)));
+  EXPECT_EQ(registry.size(), num_keys);
+
+  for (size_t i = 0; i < num_keys; i++) {
+    ASSERT_TRUE(registry.verify(i, msg_span, sig_of(i)));
+    ASSERT_FALSE(registry.verify(i, msg_span, sig_of((i + 1) % num_keys)));
+  }
+  ASSERT_FALSE(registry.verify(num_keys, msg_span, sig_of(0)));
+
+  auto stats = registry.stats();
+  EXPECT_LE(registry.num_prepared(), max_prepared);
+  EXPECT_EQ(stats.hits + stats.misses, 2 * num_keys);
+  EXPECT_GE(stats.evictions, num_keys - max_prepared);
+
+  // Most recently used public key stays prepared
+  registry.reset_stats();
+  ASSERT_TRUE(registry.verify(num_keys - 1, msg_span, sig_of(num_keys - 1)));
+  EXPECT_EQ(registry.stats().hits, 1u);
+
+  // Replacing a public key drops its prepared form
+  ASSERT_FALSE(registry.insert(num_keys - 1, pkey_of(0)));
+  ASSERT_FALSE(registry.verify(num_keys - 1, msg_span, sig_of(num_keys - 1)));
+  ASSERT_TRUE(registry.verify(num_keys - 1, msg_span, sig_of(0)));
+
+  // Erased public keys can't be verified against, while their slots get reused
+  ASSERT_TRUE(registry.erase(1));
+  ASSERT_FALSE(registry.erase(1));
+  ASSERT_FALSE(registry.contains(1));
+  ASSERT_FALSE(registry.verify(1, msg_span, sig_of(1)));
+
+  ASSERT_TRUE(registry.insert(num_keys, pkey_of(1)));
+  ASSERT_TRUE(registry.verify(num_keys, msg_span, sig_of(1)));
+  EXPECT_EQ(registry.size(), num_keys);
+
+  // Many threads, verifying against all registered public keys
+  ASSERT_FALSE(registry.insert(num_keys - 1, pkey_of(num_keys - 1)));
+  ASSERT_TRUE(registry.insert(1, pkey_of(1)));
+
+  std::atomic<size_t> num_wrong{ 0 };
+
+  std::vector<std::thread> threads{};
+  for (size_t t = 0; t < num_threads; t++) {
+    threads.emplace_back([&, t] {
+      for (size_t i = 0; i < 2 * num_keys; i++) {
+        const size_t idx = (t + i) % num_keys;
+        num_wrong += !registry.verify(idx, msg_span, sig_of(idx));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(num_wrong.load(), 0u);
+  EXPECT_LE(registry.num_prepared(), max_prepared);
+}
+
+TEST(RaccoonSign, Raccoon192PkeyRegistry)
+{
+  test_raccoon192_pkey_registry(0);
+  test_raccoon192_pkey_registry(32);
+}
+
+// Test that Raccoon-192 public keys, prepared using a shared memory matrix cache, attached to twice ( as if by two processes ), expand public matrix A
+// only once, evict only unpinned matrices and fall back to process-local expansion, when all of them are pinned.
+static void
+test_raccoon192_shm_pkey(const size_t mlen)
+{
+  constexpr size_t d = 1;
+  constexpr size_t num_keys = 3;
+  constexpr size_t num_slots = 2;
+
+  std::vector<uint8_t> seed(raccoon192::SEED_BYTE_LEN, 0);
+  std::vector<std::vector<uint8_t>> pkeys_bytes(num_keys, std::vector<uint8_t>(raccoon192::PKEY_BYTE_LEN, 0));
+  std::vector<std::vector<uint8_t>> sigs(num_keys, std::vector<uint8_t>(raccoon192::SIG_BYTE_LEN, 0));
+  std::vector<uint8_t> msg(mlen, 0);
+
+  auto seed_span = std::span<uint8_t, raccoon192::SEED_BYTE_LEN>(seed);
+  auto msg_span = std::span<uint8_t>(msg);
+
+  prng::prng_t prng;
+  prng.read(msg_span);
+
+  const auto pkey_of = [&](const size_t i) { return std::span<const uint8_t, raccoon192::PKEY_BYTE_LEN>(pkeys_bytes[i]); };
+  const auto sig_of = [&](const size_t i) { return std::span<const uint8_t, raccoon192::SIG_BYTE_LEN>(sigs[i]); };
+
+  for (size_t i = 0; i < num_keys; i++) {
+    prng.read(seed_span);
+
+    auto skey = raccoon192::raccoon192_skey_t<d>::generate(seed_span);
+    skey.get_pkey().as_bytes(std::span<uint8_t, raccoon192::PKEY_BYTE_LEN>(pkeys_bytes[i]));
+    skey.sign(msg_span, std::span<uint8_t, raccoon192::SIG_BYTE_LEN>(sigs[i]));
+  }
+
+  const std::string name = "/raccoon192_test_" + std::to_string(getpid()) + "_" + std::to_string(mlen);
+  raccoon192::raccoon192_shm_matrix_cache_t::unlink(name);
+
+  const auto cache = raccoon192::raccoon192_shm_matrix_cache_t::open(name, num_slots);
+  const auto other_cache = raccoon192::raccoon192_shm_matrix_cache_t::open(name, num_slots);
+
+  // Segment was created for another number of slots
+  EXPECT_THROW(raccoon192::raccoon192_shm_matrix_cache_t::open(name, num_slots + 1), std::invalid_argument);
+
+  {
+    const raccoon192::raccoon192_shm_pkey_t pkey(*cache, pkey_of(0));
+    const raccoon192::raccoon192_shm_pkey_t other_pkey(*other_cache, pkey_of(0));
+
+    // Second attachment finds public matrix A, expanded by the first one
+    EXPECT_TRUE(pkey.is_shared());
+    EXPECT_TRUE(other_pkey.is_shared());
+    EXPECT_EQ(cache->stats().misses, 1u);
+    EXPECT_EQ(other_cache->stats().hits, 1u);
+
+    ASSERT_TRUE(pkey.verify(msg_span, sig_of(0)));
+    ASSERT_TRUE(other_pkey.verify(msg_span, sig_of(0)));
+    ASSERT_TRUE(other_pkey.verify_vartime(msg_span, sig_of(0)));
+    ASSERT_FALSE(other_pkey.verify(msg_span, sig_of(1)));
+
+    // All slots are pinned, hence the last public key gets its matrix A expanded in process-local memory
+    const raccoon192::raccoon192_shm_pkey_t pkey1(*other_cache, pkey_of(1));
+    const raccoon192::raccoon192_shm_pkey_t pkey2(*other_cache, pkey_of(2));
+
+    EXPECT_TRUE(pkey1.is_shared());
+    EXPECT_FALSE(pkey2.is_shared());
+    EXPECT_EQ(other_cache->stats().fallbacks, 1u);
+
+    ASSERT_TRUE(pkey1.verify(msg_span, sig_of(1)));
+    ASSERT_TRUE(pkey2.verify(msg_span, sig_of(2)));
+    ASSERT_TRUE(pkey2.get_pkey().verify(msg_span, sig_of(2)));
+  }
+
+  // Once unpinned, least recently used matrix A gets evicted, to make room
+  cache->reset_stats();
+  {
+    const raccoon192::raccoon192_shm_pkey_t pkey2(*cache, pkey_of(2));
+    EXPECT_TRUE(pkey2.is_shared());
+    EXPECT_EQ(cache->stats().misses, 1u);
+    ASSERT_TRUE(pkey2.verify(msg_span, sig_of(2)));
+
+    const raccoon192::raccoon192_shm_pkey_t pkey1(*cache, pkey_of(1));
+    EXPECT_TRUE(pkey1.is_shared());
+    EXPECT_EQ(cache->stats().hits, 1u);
+  }
+
+  // Attachment checking digests accepts matrices published by others, hashing each of them only once
+  {
+    const auto checked_cache = raccoon192::raccoon192_shm_matrix_cache_t::open(name, num_slots, raccoon192::raccoon192_shm_trust_t::checked);
+    EXPECT_EQ(checked_cache->get_trust(), raccoon192::raccoon192_shm_trust_t::checked);
+
+    const raccoon192::raccoon192_shm_pkey_t pkey1(*checked_cache, pkey_of(1));
+    const raccoon192::raccoon192_shm_pkey_t other_pkey1(*checked_cache, pkey_of(1));
+
+    EXPECT_TRUE(pkey1.is_shared());
+    EXPECT_EQ(checked_cache->stats().hits, 2u);
+    EXPECT_EQ(checked_cache->stats().corrupted, 0u);
+    ASSERT_TRUE(other_pkey1.verify(msg_span, sig_of(1)));
+  }
+
+  raccoon192::raccoon192_shm_matrix_cache_t::unlink(name);
+}
+
+TEST(RaccoonSign, Raccoon192ShmPkey)
+{
+  test_raccoon192_shm_pkey(0);
+  test_raccoon192_shm_pkey(32);
+}
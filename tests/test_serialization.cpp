@@ -1,6 +1,7 @@
 #include "raccoon/internals/math/field.hpp"
 #include "raccoon/internals/signature.hpp"
 #include "raccoon/internals/utility/serialization.hpp"
+#include "test_helper.hpp"
 #include <algorithm>
 #include <gtest/gtest.h>
 
@@ -115,3 +116,368 @@ TEST(RaccoonSign, ZeroPolynomialSecretKeyEncodingAndDecoding)
   test_encode_decode_signature_all_zeros<7, 5, 192, 44, 14544>();
   test_encode_decode_signature_all_zeros<9, 7, 256, 44, 20330>();
 }
+
+// Generate random signature components, with varying magnitude and density of coefficients, ensuring that pre-checking them tells the same story as
+// encoding the signature, followed by norms check, on successful encoding. Ensures that each pre-check outcome is observed at least once.
+template<size_t k, size_t l, size_t 𝜅, size_t 𝜈w, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+static void
+test_signature_precheck()
+{
+  constexpr uint64_t Q_prime = field::Q >> 𝜈w;
+
+  std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
+  std::array<uint8_t, sig_byte_len> sig_bytes{};
+  std::array<size_t, 3> outcome_cnt{};
+
+  prng::prng_t prng{};
+  prng.read(c_hash);
+
+  // Samples a centered value ∈ [-bound, bound], which is non-zero with probability ~ density/ 256
+  const auto sample_centered = [&](const uint64_t bound, const uint8_t density) -> int64_t {
+    std::array<uint8_t, sizeof(uint64_t) + 1> rand{};
+    prng.read(rand);
+
+    if (rand[0] >= density) {
+      return 0;
+    }
+
+    const auto x = raccoon_utils::from_le_bytes<uint64_t>(std::span(rand).subspan(1)) % (2 * bound + 1);
+    return static_cast<int64_t>(x) - static_cast<int64_t>(bound);
+  };
+
+  for (const uint64_t h_bound : { 0ul, 1ul, 2ul, (Binf >> 𝜈w) + 1 }) {
+    for (const uint64_t z_bound : { 1ul << 36, 1ul << 40, 1ul << 42, Binf, Binf + 1, 1ul << 47 }) {
+      for (const uint8_t density : { 8, 64, 255 }) {
+        raccoon_poly_vec::poly_vec_t<k, 1> h{};
+        raccoon_poly_vec::poly_vec_t<l, 1> z{};
+
+        std::array<int64_t, raccoon_poly::N> centered{};
+
+        for (size_t ridx = 0; ridx < k; ridx++) {
+          std::generate(centered.begin(), centered.end(), [&] { return sample_centered(h_bound, density); });
+          h[ridx][0] = raccoon_poly::poly_t::from_centered<Q_prime>(centered);
+        }
+        for (size_t ridx = 0; ridx < l; ridx++) {
+          std::generate(centered.begin(), centered.end(), [&] { return sample_centered(z_bound, 255); });
+          z[ridx][0] = raccoon_poly::poly_t::from_centered<field::Q>(centered);
+        }
+
+        auto sig = raccoon_sig::sig_t<𝜅, k, l, 𝜈w, sig_byte_len>(c_hash, h, z);
+        const bool is_encoded = sig.to_bytes(sig_bytes);
+
+        auto expected = raccoon_sig::precheck_t::too_long;
+        if (is_encoded) {
+          expected = sig.template check_bounds<Binf, B22>() ? raccoon_sig::precheck_t::ok : raccoon_sig::precheck_t::out_of_bounds;
+        }
+
+        const auto computed = raccoon_sig::precheck<𝜅, k, l, 𝜈w, sig_byte_len, Binf, B22>(h, z);
+        EXPECT_EQ(computed, expected);
+
+        outcome_cnt[static_cast<size_t>(computed)]++;
+      }
+    }
+  }
+
+  EXPECT_GT(outcome_cnt[static_cast<size_t>(raccoon_sig::precheck_t::ok)], 0ul);
+  EXPECT_GT(outcome_cnt[static_cast<size_t>(raccoon_sig::precheck_t::too_long)], 0ul);
+  EXPECT_GT(outcome_cnt[static_cast<size_t>(raccoon_sig::precheck_t::out_of_bounds)], 0ul);
+}
+
+TEST(RaccoonSign, SignaturePrecheck)
+{
+  test_signature_precheck<5, 4, 128, 44, 11524, 41954689765971ul, 14656575897ul>();
+  test_signature_precheck<7, 5, 192, 44, 14544, 47419426657048ul, 24964497408ul>();
+  test_signature_precheck<9, 7, 256, 44, 20330, 50958538642039ul, 38439957299ul>();
+}
+
+// Generate random signature components, with varying magnitude of coefficients, encode them and then flip random bits of the encoded signature, ensuring
+// that decoding it straight into polynomial vectors tells the same story as decoding it into a signature object, followed by norms check, and that both
+// of them produce same components, on success.
+template<size_t k, size_t l, size_t 𝜅, size_t 𝜈w, size_t sig_byte_len, uint64_t Binf, uint64_t B22>
+static void
+test_signature_direct_decode()
+{
+  constexpr uint64_t Q_prime = field::Q >> 𝜈w;
+  constexpr size_t num_bitflips = 32;
+
+  std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
+  std::array<uint8_t, sig_byte_len> sig_bytes{};
+  std::array<size_t, 2> outcome_cnt{};
+
+  prng::prng_t prng{};
+  prng.read(c_hash);
+
+  // Samples a centered value ∈ [-bound, bound]
+  const auto sample_centered = [&](const uint64_t bound) -> int64_t {
+    uint64_t rand = 0;
+    prng.read(std::span<uint8_t, sizeof(rand)>(reinterpret_cast<uint8_t*>(&rand), sizeof(rand)));
+
+    return static_cast<int64_t>(rand % (2 * bound + 1)) - static_cast<int64_t>(bound);
+  };
+
+  for (const uint64_t h_bound : { 0ul, 1ul, (Binf >> 𝜈w) + 1 }) {
+    for (const uint64_t z_bound : { 1ul << 36, 1ul << 40, Binf + 1 }) {
+      raccoon_poly_vec::poly_vec_t<k, 1> h{};
+      raccoon_poly_vec::poly_vec_t<l, 1> z{};
+
+      std::array<int64_t, raccoon_poly::N> centered{};
+
+      for (size_t ridx = 0; ridx < k; ridx++) {
+        std::generate(centered.begin(), centered.end(), [&] { return sample_centered(h_bound); });
+        h[ridx][0] = raccoon_poly::poly_t::from_centered<Q_prime>(centered);
+      }
+      // Response vector, uniformly sampled with an out of bounds bound, never fits, hence only one of its coefficients is pushed out of bounds
+      const bool is_z_oob = z_bound > Binf;
+
+      for (size_t ridx = 0; ridx < l; ridx++) {
+        std::generate(centered.begin(), centered.end(), [&] { return sample_centered(is_z_oob ? (1ul << 36) : z_bound); });
+        if (is_z_oob && (ridx == 0)) {
+          centered[0] = static_cast<int64_t>(z_bound);
+        }
+
+        z[ridx][0] = raccoon_poly::poly_t::from_centered<field::Q>(centered);
+      }
+
+      const auto sig = raccoon_sig::sig_t<𝜅, k, l, 𝜈w, sig_byte_len>(c_hash, h, z);
+      if (!sig.to_bytes(sig_bytes)) {
+        continue;
+      }
+
+      for (size_t i = 0; i <= num_bitflips; i++) {
+        // First round decodes the untouched signature
+        if (i > 0) {
+          random_bitflip(sig_bytes, prng);
+        }
+
+        auto staged = raccoon_sig::sig_t<𝜅, k, l, 𝜈w, sig_byte_len>::from_bytes(sig_bytes);
+        const bool expected = staged.has_value() && staged.value().template check_bounds<Binf, B22>();
+
+        std::array<uint8_t, c_hash.size()> direct_c_hash{};
+        raccoon_poly_vec::poly_vec_t<k, 1> direct_h{};
+        raccoon_poly_vec::poly_vec_t<l, 1> direct_z{};
+
+        const bool computed = raccoon_sig::decode_and_check<𝜅, k, l, 𝜈w, sig_byte_len, Binf, B22>(sig_bytes, direct_c_hash, direct_h, direct_z);
+        EXPECT_EQ(computed, expected);
+
+        if (computed && expected) {
+          EXPECT_TRUE(std::ranges::equal(direct_c_hash, staged.value().get_c_hash()));
+          EXPECT_EQ(direct_h, staged.value().get_h());
+          EXPECT_EQ(direct_z, staged.value().get_z());
+        }
+
+        outcome_cnt[static_cast<size_t>(computed)]++;
+      }
+    }
+  }
+
+  EXPECT_GT(outcome_cnt[0], 0ul);
+  EXPECT_GT(outcome_cnt[1], 0ul);
+}
+
+TEST(RaccoonSign, SignatureDirectDecode)
+{
+  test_signature_direct_decode<5, 4, 128, 44, 11524, 41954689765971ul, 14656575897ul>();
+  test_signature_direct_decode<7, 5, 192, 44, 14544, 47419426657048ul, 24964497408ul>();
+  test_signature_direct_decode<9, 7, 256, 44, 20330, 50958538642039ul, 38439957299ul>();
+}
+
+// Decodes a byte encoded signature, bit by bit, following section 2.5.1 of the Raccoon specification literally, without bounding the length of unary runs.
+// Returns false, if the signature isn't canonically encoded, else returns true, along with the length of the longest unary run, seen during decoding.
+template<size_t 𝜅, size_t k, size_t l, size_t sig_byte_len>
+static bool
+reference_decode_sig(std::span<const uint8_t, sig_byte_len> sig,
+                     std::span<int64_t, k * raccoon_poly::N> h,
+                     std::span<int64_t, l * raccoon_poly::N> z,
+                     size_t& max_run)
+{
+  constexpr size_t num_bits = sig_byte_len * std::numeric_limits<uint8_t>::digits;
+  size_t bit_idx = 2 * 𝜅;
+
+  const auto next_bit = [&](uint64_t& bit) {
+    if (bit_idx == num_bits) {
+      return false;
+    }
+
+    bit = (sig[bit_idx / 8] >> (bit_idx % 8)) & 0b1u;
+    bit_idx++;
+    return true;
+  };
+
+  const auto next_unary = [&](uint64_t& run) {
+    uint64_t bit = 0;
+
+    run = 0;
+    while (true) {
+      if (!next_bit(bit)) {
+        return false;
+      }
+      if (bit == 0) {
+        break;
+      }
+
+      run++;
+    }
+
+    max_run = std::max<size_t>(max_run, run);
+    return true;
+  };
+
+  const auto next_signed = [&](const uint64_t magnitude, int64_t& coeff) {
+    uint64_t sign = 0;
+    if ((magnitude > 0) && !next_bit(sign)) {
+      return false;
+    }
+
+    coeff = sign ? -static_cast<int64_t>(magnitude) : static_cast<int64_t>(magnitude);
+    return true;
+  };
+
+  max_run = 0;
+
+  for (auto& coeff : h) {
+    uint64_t run = 0;
+    if (!next_unary(run) || !next_signed(run, coeff)) {
+      return false;
+    }
+  }
+
+  for (auto& coeff : z) {
+    uint64_t a = 0, bit = 0;
+    for (size_t i = 0; i < 40; i++) {
+      if (!next_bit(bit)) {
+        return false;
+      }
+      a |= bit << i;
+    }
+
+    uint64_t b = 0;
+    if (!next_unary(b) || !next_signed((b << 40) | a, coeff)) {
+      return false;
+    }
+  }
+
+  uint64_t bit = 0;
+  while (next_bit(bit)) {
+    if (bit == 1) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Ensures that the word-level signature decoder accepts exactly those signatures, which the bit by bit reference decoder accepts, except for the ones
+// with unary runs longer than the decoder allows, and that both decode to same components. Signatures are random ones, whose random bits get flipped,
+// and ones whose encoding ends exactly at or just before the end of the signature.
+template<size_t k, size_t l, size_t 𝜅, size_t 𝜈w, size_t sig_byte_len>
+static void
+test_canonical_signature_decode()
+{
+  constexpr uint64_t Q_prime = field::Q >> 𝜈w;
+  constexpr size_t num_bitflips = 16;
+
+  std::array<uint8_t, (2 * 𝜅) / std::numeric_limits<uint8_t>::digits> c_hash{};
+  std::array<uint8_t, sig_byte_len> sig_bytes{};
+
+  prng::prng_t prng{};
+  prng.read(c_hash);
+
+  const auto random_u64 = [&]() {
+    uint64_t rand = 0;
+    prng.read(std::span<uint8_t, sizeof(rand)>(reinterpret_cast<uint8_t*>(&rand), sizeof(rand)));
+    return rand;
+  };
+
+  const auto check_against_reference = [&]() {
+    std::array<uint8_t, c_hash.size()> comp_c_hash{};
+    std::array<int64_t, k * raccoon_poly::N> comp_h{}, ref_h{};
+    std::array<int64_t, l * raccoon_poly::N> comp_z{}, ref_z{};
+    size_t max_run = 0;
+
+    const bool expected = reference_decode_sig<𝜅, k, l, sig_byte_len>(sig_bytes, ref_h, ref_z, max_run) &&
+                          (max_run <= raccoon_serialization::bit_reader_t::MAX_UNARY_RUN);
+    const bool computed = raccoon_serialization::decode_sig<𝜅, k, l, sig_byte_len>(sig_bytes, comp_c_hash, comp_h, comp_z);
+    EXPECT_EQ(computed, expected);
+
+    if (computed && expected) {
+      EXPECT_EQ(comp_c_hash, c_hash);
+      EXPECT_EQ(comp_h, ref_h);
+      EXPECT_EQ(comp_z, ref_z);
+    }
+
+    return computed;
+  };
+
+  // Signatures with randomly sampled components, whose random bits get flipped
+  for (const uint64_t h_bound : { 0ul, 1ul, 8ul }) {
+    for (const uint64_t z_bound : { 1ul << 36, 1ul << 40, 1ul << 44 }) {
+      raccoon_poly_vec::poly_vec_t<k, 1> h{};
+      raccoon_poly_vec::poly_vec_t<l, 1> z{};
+
+      std::array<int64_t, raccoon_poly::N> centered{};
+
+      for (size_t ridx = 0; ridx < k; ridx++) {
+        std::generate(centered.begin(), centered.end(), [&] { return static_cast<int64_t>(random_u64() % (2 * h_bound + 1)) - static_cast<int64_t>(h_bound); });
+        h[ridx][0] = raccoon_poly::poly_t::from_centered<Q_prime>(centered);
+      }
+      for (size_t ridx = 0; ridx < l; ridx++) {
+        std::generate(centered.begin(), centered.end(), [&] { return static_cast<int64_t>(random_u64() % (2 * z_bound + 1)) - static_cast<int64_t>(z_bound); });
+        z[ridx][0] = raccoon_poly::poly_t::from_centered<field::Q>(centered);
+      }
+
+      if (!raccoon_sig::sig_t<𝜅, k, l, 𝜈w, sig_byte_len>(c_hash, h, z).to_bytes(sig_bytes)) {
+        continue;
+      }
+
+      EXPECT_TRUE(check_against_reference());
+      for (size_t i = 0; i < num_bitflips; i++) {
+        random_bitflip(std::span(sig_bytes).subspan(c_hash.size()), prng);
+        check_against_reference();
+      }
+    }
+  }
+
+  // Signatures with `h = 0` and each coefficient of `z` having non-zero low 40 -bits, so that each of them takes 42 -bits, plus the length of its unary
+  // encoded high part, which are chosen such that encoding leaves exactly `slack` -many padding bits at the end of the signature
+  constexpr size_t free_num_bits = (sig_byte_len - c_hash.size()) * std::numeric_limits<uint8_t>::digits - k * raccoon_poly::N - l * raccoon_poly::N * 42;
+  static_assert(free_num_bits >= l * raccoon_poly::N, "Each coefficient of z must have a non-zero high part");
+
+  for (const size_t slack : { 0ul, 1ul, 7ul, 8ul, 9ul }) {
+    const size_t run_num_bits = free_num_bits - slack;
+
+    raccoon_poly_vec::poly_vec_t<k, 1> h{};
+    raccoon_poly_vec::poly_vec_t<l, 1> z{};
+
+    for (size_t ridx = 0; ridx < l; ridx++) {
+      std::array<int64_t, raccoon_poly::N> centered{};
+
+      for (size_t cidx = 0; cidx < raccoon_poly::N; cidx++) {
+        const size_t idx = ridx * raccoon_poly::N + cidx;
+        const uint64_t b = run_num_bits / (l * raccoon_poly::N) + (idx < (run_num_bits % (l * raccoon_poly::N)));
+        const uint64_t a = (random_u64() & ((1ul << 40) - 1)) | 0b1ul;
+
+        const auto magnitude = static_cast<int64_t>((b << 40) | a);
+        centered[cidx] = (random_u64() & 0b1ul) ? -magnitude : magnitude;
+      }
+
+      z[ridx][0] = raccoon_poly::poly_t::from_centered<field::Q>(centered);
+    }
+
+    const auto sig = raccoon_sig::sig_t<𝜅, k, l, 𝜈w, sig_byte_len>(c_hash, h, z);
+    EXPECT_TRUE(sig.to_bytes(sig_bytes));
+    EXPECT_TRUE(check_against_reference());
+
+    // Any non-zero padding bit makes the encoding non-canonical
+    if (slack > 0) {
+      sig_bytes.back() ^= 0x80;
+      EXPECT_FALSE(check_against_reference());
+    }
+  }
+}
+
+TEST(RaccoonSign, CanonicalSignatureDecode)
+{
+  test_canonical_signature_decode<5, 4, 128, 44, 11524>();
+  test_canonical_signature_decode<7, 5, 192, 44, 14544>();
+  test_canonical_signature_decode<9, 7, 256, 44, 20330>();
+}